@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// ofxMovingAverage RMS smoothing in an audio callback at 48 kHz x 8 channels:
+// per sample add() vs batch add(), relative to the callback deadline
+//
+// each channel is deinterleaved & squared, then added to a 100 ms window
+class AudioBenchmark : public Benchmark {
+
+	public:
+
+		AudioBenchmark() : Benchmark("audio moving average") {}
+
+		static constexpr unsigned int SAMPLE_RATE = 48000;
+		static constexpr unsigned int CHANNELS = 8;
+		static constexpr unsigned int BUFFER_SIZE = 512; // frames per callback
+		static constexpr unsigned int NUM_CALLBACKS = 1000;
+
+		void runBenchmark() {
+			double deadline = BUFFER_SIZE * 1000.0 / SAMPLE_RATE;
+			print(ofToString(SAMPLE_RATE) + " Hz, " + ofToString(CHANNELS) +
+			      " channels, " + ofToString(BUFFER_SIZE) + " frames, deadline " +
+			      ofToString(deadline, 3) + " ms");
+
+			// a noisy interleaved input buffer
+			ofSeedRandom(0);
+			std::vector<float> input(BUFFER_SIZE * CHANNELS);
+			for(unsigned int i = 0; i < input.size(); ++i) {
+				input[i] = ofRandom(-1, 1);
+			}
+
+			ofxTimingStats perSample = runCallbacks(input, false);
+			print("per sample add", perSample);
+			print("    " + ofToString(perSample.max() / deadline * 100, 2) + "% of the deadline at max");
+
+			ofxTimingStats batch = runCallbacks(input, true);
+			print("batch add", batch);
+			print("    " + ofToString(batch.max() / deadline * 100, 2) + "% of the deadline at max");
+		}
+
+	protected:
+
+		// simulate callbacks, returns the callback times
+		ofxTimingStats runCallbacks(const std::vector<float> &input, bool bBatch) {
+			std::vector<ofxMovingAverage> rms(CHANNELS, ofxMovingAverage(SAMPLE_RATE / 10));
+			std::vector<float> squares(BUFFER_SIZE);
+			ofxTimingStats times;
+			times.setSize(NUM_CALLBACKS);
+			double sum = 0; // keeps the averages from being optimized out
+			for(unsigned int n = 0; n < NUM_CALLBACKS; ++n) {
+				uint64_t start = now();
+				for(unsigned int c = 0; c < CHANNELS; ++c) {
+					for(unsigned int i = 0; i < BUFFER_SIZE; ++i) {
+						float sample = input[i * CHANNELS + c];
+						squares[i] = sample * sample;
+					}
+					if(bBatch) {
+						rms[c].add(squares.data(), BUFFER_SIZE);
+					}
+					else {
+						for(unsigned int i = 0; i < BUFFER_SIZE; ++i) {
+							rms[c].add(squares[i]);
+						}
+					}
+					sum += sqrt(rms[c].avg());
+				}
+				times.add(since(start));
+			}
+			ofLogVerbose("Benchmark") << "rms sum " << sum;
+			return times;
+		}
+};
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+#include "ChurnBenchmark.h"
+
+// ofxParticleBatch mesh building, which runs on the CPU without drawing:
+// checks the vertex & index counts and quad corners, then times building
+// 100k quads per frame vs adding them to an ofMesh one vertex at a time
+class BatchBenchmark : public Benchmark {
+
+	public:
+
+		BatchBenchmark() : Benchmark("particle batch") {}
+
+		static constexpr unsigned int NUM_PARTICLES = 100000;
+		static constexpr unsigned int NUM_FRAMES = 60;
+
+		void runBenchmark() {
+			runChecks();
+
+			ofSeedRandom(0);
+			std::vector<ofxParticle*> particles(NUM_PARTICLES);
+			for(unsigned int i = 0; i < NUM_PARTICLES; ++i) {
+				particles[i] = new BenchParticle(ofRandom(1920), ofRandom(1080));
+			}
+			print(ofToString(NUM_PARTICLES) + " particles");
+
+			// before: a new mesh each frame
+			ofMesh mesh;
+			mesh.setMode(OF_PRIMITIVE_TRIANGLES);
+			ofxTimingStats meshTimes;
+			meshTimes.setSize(NUM_FRAMES);
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				uint64_t start = now();
+				mesh.clear();
+				for(unsigned int i = 0; i < particles.size(); ++i) {
+					const ofxParticle *p = particles[i];
+					ofIndexType v = mesh.getNumVertices();
+					mesh.addVertex(ofDefaultVertexType(p->x, p->y, 0));
+					mesh.addVertex(ofDefaultVertexType(p->x + p->width, p->y, 0));
+					mesh.addVertex(ofDefaultVertexType(p->x + p->width, p->y + p->height, 0));
+					mesh.addVertex(ofDefaultVertexType(p->x, p->y + p->height, 0));
+					mesh.addIndex(v);
+					mesh.addIndex(v + 1);
+					mesh.addIndex(v + 2);
+					mesh.addIndex(v);
+					mesh.addIndex(v + 2);
+					mesh.addIndex(v + 3);
+				}
+				meshTimes.add(since(start));
+			}
+			print("ofMesh add build", meshTimes);
+
+			// after: reuse the batch buffers
+			ofxParticleBatch batch;
+			ofxTimingStats batchTimes;
+			batchTimes.setSize(NUM_FRAMES);
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				uint64_t start = now();
+				batch.build(particles, OF_RECTMODE_CORNER);
+				batchTimes.add(since(start));
+			}
+			print("batch build", batchTimes);
+
+			for(unsigned int i = 0; i < particles.size(); ++i) {
+				delete particles[i];
+			}
+		}
+
+	protected:
+
+		void runChecks() {
+			ofxParticleBatch batch;
+			ofMesh &mesh = batch.getMesh();
+
+			batch.begin(OF_RECTMODE_CORNER);
+			batch.addQuad(10, 20, 4, 2);
+			batch.addQuad(0, 0, 1, 1);
+			batch.end();
+			check(counts(mesh, 2), "2 quads have 8 vertices & 12 indices");
+			check(corners(mesh, 0, 10, 20, 14, 22) && corners(mesh, 1, 0, 0, 1, 1),
+			      "corner mode quad corners");
+			check(indices(mesh, 2), "2 quad indices");
+
+			batch.begin(OF_RECTMODE_CENTER);
+			batch.addQuad(10, 20, 4, 2);
+			batch.end();
+			check(counts(mesh, 1), "shrinking to 1 quad trims the mesh");
+			check(corners(mesh, 0, 8, 19, 12, 21), "center mode quad corners");
+
+			batch.begin(OF_RECTMODE_CORNER);
+			for(unsigned int i = 0; i < 3; ++i) {
+				batch.addQuad(i * 10, 0, 5, 5);
+			}
+			batch.end();
+			check(counts(mesh, 3) && indices(mesh, 3), "growing to 3 quads extends the indices");
+			check(corners(mesh, 2, 20, 0, 25, 5), "grown quad corners");
+
+			std::vector<ofxParticle*> particles;
+			particles.push_back(new BenchParticle(1, 2));
+			particles.push_back(NULL);
+			particles.push_back(new BenchParticle(3, 4));
+			batch.build(particles, OF_RECTMODE_CORNER);
+			check(batch.size() == 2 && counts(mesh, 2), "building from particles skips NULLs");
+			check(corners(mesh, 1, 3, 4, 7, 8), "particle quad corners");
+			for(unsigned int i = 0; i < particles.size(); ++i) {
+				delete particles[i];
+			}
+		}
+
+		// does the mesh hold a number of quads?
+		static bool counts(ofMesh &mesh, unsigned int quads) {
+			return mesh.getNumVertices() == quads * 4 && mesh.getNumIndices() == quads * 6;
+		}
+
+		// are a quad's corners clockwise from the top left?
+		static bool corners(ofMesh &mesh, unsigned int quad,
+		                    float left, float top, float right, float bottom) {
+			std::vector<ofDefaultVertexType> &verts = mesh.getVertices();
+			unsigned int v = quad * 4;
+			return verts[v].x == left && verts[v].y == top &&
+			       verts[v+1].x == right && verts[v+1].y == top &&
+			       verts[v+2].x == right && verts[v+2].y == bottom &&
+			       verts[v+3].x == left && verts[v+3].y == bottom;
+		}
+
+		// are the quads indexed as two triangles each?
+		static bool indices(ofMesh &mesh, unsigned int quads) {
+			std::vector<ofIndexType> &indices = mesh.getIndices();
+			static const ofIndexType pattern[6] = {0, 1, 2, 0, 2, 3};
+			for(unsigned int i = 0; i < quads * 6; ++i) {
+				if(indices[i] != (i / 6) * 4 + pattern[i % 6]) {
+					return false;
+				}
+			}
+			return true;
+		}
+};
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <ofxAppUtils.h>
+
+// base class for a single benchmark, results are logged & kept as lines of
+// text so the app can draw & save them
+//
+// all times are wall times from the steady clock in ms, work which depends on
+// ofxTimer (particle ages, alarms, etc) is driven by a manual clock so runs
+// are repeatable
+class Benchmark {
+
+	public:
+
+		Benchmark(const std::string &name) : name(name) {}
+		virtual ~Benchmark() {}
+
+		// run the benchmark, clears the last results
+		void run() {
+			results.clear();
+			print("---- " + name + " ----");
+			ofxClock *lastClock = ofxTimer::getClock();
+			clock.set(0);
+			ofxTimer::setClock(&clock);
+			runBenchmark();
+			ofxTimer::setClock(lastClock);
+		}
+
+		const std::string& getName() {return name;}
+		const std::vector<std::string>& getResults() {return results;}
+
+	protected:
+
+		// implement this
+		virtual void runBenchmark() = 0;
+
+		// get the current wall time in ns
+		static uint64_t now() {return ofxSteadyClock::get();}
+
+		// get the wall time since a start time in ms
+		static double since(uint64_t start) {
+			return (ofxSteadyClock::get() - start) / 1000000.0;
+		}
+
+		// add a result line & log it
+		void print(const std::string &line) {
+			results.push_back(line);
+			ofLogNotice("Benchmark") << line;
+		}
+
+		// add a pass/fail result line for a correctness check
+		bool check(bool ok, const std::string &what) {
+			print((ok ? "ok: " : "FAILED: ") + what);
+			return ok;
+		}
+
+		// print timing stats in ms, ie. per frame times
+		void print(const std::string &label, ofxTimingStats &stats) {
+			print(label + ": avg " + ofToString(stats.avg(), 3) +
+			      " p50 " + ofToString(stats.p50(), 3) +
+			      " p99 " + ofToString(stats.p99(), 3) +
+			      " max " + ofToString(stats.max(), 3) + " ms");
+		}
+
+		// print a frame time histogram, skips empty bins
+		void print(const std::string &label, ofxFrameStats &stats) {
+			print(label + ": " + ofToString(stats.getCount()) + " frames, avg " +
+			      ofToString(stats.avg(), 3) + " max " + ofToString(stats.max(), 3) +
+			      " ms, " + ofToString(stats.getNumHitches()) + " hitches");
+			for(unsigned int i = 0; i < stats.getNumBins(); ++i) {
+				if(stats.getBin(i) == 0) {
+					continue;
+				}
+				float low = i * stats.getBinWidth();
+				std::string range = (i + 1 < stats.getNumBins()) ?
+					ofToString(low) + "-" + ofToString(low + stats.getBinWidth()) :
+					ofToString(low) + "+";
+				print("    " + range + " ms: " + ofToString(stats.getBin(i)));
+			}
+		}
+
+		std::string name; // benchmark name
+		std::vector<std::string> results; // result lines
+		ofxManualClock clock; // ofxTimer clock while running, starts at 0
+};
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// a particle which just moves
+class BenchParticle : public ofxParticle {
+
+	public:
+
+		BenchParticle(float x=0, float y=0) : ofxParticle(x, y, 4, 4), vx(1), vy(-1) {}
+
+		void update() {
+			x += vx;
+			y += vy;
+		}
+
+		void draw() {}
+
+		float vx, vy;
+};
+
+// removes dead particles one at a time with vector::erase, as
+// ofxParticleManager did before single pass removal
+class EraseParticleManager : public ofxParticleManager {
+
+	public:
+
+		void update() {
+			std::vector<ofxParticle*>::iterator iter;
+			for(iter = particles.begin(); iter != particles.end();) {
+				if(!(*iter)->isAlive()) {
+					delete (*iter);
+					iter = particles.erase(iter);
+				}
+				else {
+					(*iter)->update();
+					++iter;
+				}
+			}
+		}
+};
+
+// ofxParticleManager update() time with 100k particles & 10% churn per
+// frame: erase per dead particle vs swap removal vs order preserving removal
+class ChurnBenchmark : public Benchmark {
+
+	public:
+
+		ChurnBenchmark() : Benchmark("particle churn") {}
+
+		static constexpr unsigned int NUM_PARTICLES = 100000;
+		static constexpr unsigned int CHURN = 10; // kill 1 in CHURN particles per frame
+
+		void runBenchmark() {
+			print(ofToString(NUM_PARTICLES) + " particles, " +
+			      ofToString(100 / CHURN) + "% churn per frame");
+
+			EraseParticleManager eraseManager;
+			runFrames("erase", eraseManager, 10); // slow, keep it short
+
+			ofxParticleManager swapManager;
+			runFrames("swap", swapManager, 200);
+
+			ofxParticleManager orderManager;
+			orderManager.setPreserveOrder(true);
+			runFrames("preserve order", orderManager, 200);
+		}
+
+	protected:
+
+		// fill the manager, then kill, update, & respawn each frame
+		void runFrames(const std::string &label, ofxParticleManager &manager,
+		               unsigned int numFrames) {
+			ofSeedRandom(0);
+			ofxTimingStats updateTimes;
+			updateTimes.setSize(numFrames);
+			respawn(manager);
+			for(unsigned int frame = 0; frame < numFrames; ++frame) {
+				for(unsigned int i = frame % CHURN; i < manager.size(); i += CHURN) {
+					manager.getParticle(i)->kill();
+				}
+				uint64_t start = now();
+				manager.update();
+				updateTimes.add(since(start));
+				respawn(manager);
+			}
+			print(label + " update", updateTimes);
+			manager.clear();
+		}
+
+		// add particles up to NUM_PARTICLES
+		void respawn(ofxParticleManager &manager) {
+			while(manager.size() < NUM_PARTICLES) {
+				manager.addParticle(new BenchParticle(ofRandom(1920), ofRandom(1080)));
+			}
+		}
+};
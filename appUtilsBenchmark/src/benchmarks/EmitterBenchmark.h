@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+#include "ChurnBenchmark.h"
+
+// frame time histograms for a burst of 10k particles on every beat: new'd
+// ofxParticles in an ofxParticleManager vs an ofxParticleEmitter spawning
+// into a pre-reserved ofxParticlePool
+//
+// the frame time is the spawn & update time, the ofxTimer clock steps 1/60 s
+// per frame so particles die on the same frames in both runs
+class EmitterBenchmark : public Benchmark {
+
+	public:
+
+		EmitterBenchmark() : Benchmark("emitter bursts") {}
+
+		static constexpr unsigned int BURST = 10000;
+		static constexpr unsigned int BEAT_FRAMES = 30; // frames between bursts
+		static constexpr unsigned int NUM_FRAMES = 600;
+
+		void runBenchmark() {
+			print(ofToString(BURST) + " particles every " + ofToString(BEAT_FRAMES) +
+			      " frames, 0.5-1 s lifespans");
+			ofxFrameStats stats(NUM_FRAMES);
+			stats.setHistogram(20, 0.25);
+			stats.setHitchThreshold(2);
+
+			// before: allocate each particle
+			ofSeedRandom(0);
+			ofxParticleManager manager;
+			manager.setAutoAge(true);
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				clock.stepMillis(1000.0 / 60.0);
+				uint64_t start = now();
+				if(frame % BEAT_FRAMES == 0) {
+					for(unsigned int i = 0; i < BURST; ++i) {
+						BenchParticle *p = new BenchParticle(ofRandom(1920), ofRandom(1080));
+						p->setLifespan(ofRandom(500, 1000));
+						p->vx = ofRandom(-2, 2);
+						p->vy = ofRandom(-2, 2);
+						manager.addParticle(p);
+					}
+				}
+				manager.update();
+				stats.add(since(start));
+			}
+			print("new particles", stats);
+			manager.clear();
+
+			// after: emit into a pool, recycling dead slots
+			ofSeedRandom(0);
+			stats.clear();
+			ofxParticlePool pool(BURST * 4);
+			ofxParticleEmitter emitter;
+			emitter.setArea(ofRectangle(0, 0, 1920, 1080));
+			emitter.setSize(4, 4);
+			emitter.setLifespan(500, 1000);
+			emitter.setVelocity(ofVec2f(-2, -2), ofVec2f(2, 2));
+			ofxParticleIntegrator integrator;
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				clock.stepMillis(1000.0 / 60.0);
+				uint64_t start = now();
+				if(frame % BEAT_FRAMES == 0) {
+					emitter.burst(pool, BURST);
+				}
+				pool.update();
+				pool.integrate(integrator);
+				stats.add(since(start));
+			}
+			print("emitter & pool", stats);
+		}
+};
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// ofxParticleGrid neighbor queries vs a brute force O(n^2) loop: find the
+// neighbors within a radius of every particle, as flocking would
+class GridBenchmark : public Benchmark {
+
+	public:
+
+		GridBenchmark() : Benchmark("spatial grid") {}
+
+		static constexpr float RADIUS = 25;
+		static constexpr unsigned int NUM_FRAMES = 5;
+
+		void runBenchmark() {
+			print("neighbors within " + ofToString(RADIUS) + " px in 1920x1080");
+			runFrames(1000);
+			runFrames(5000);
+			runFrames(20000);
+		}
+
+	protected:
+
+		void runFrames(unsigned int num) {
+			ofSeedRandom(0);
+			std::vector<float> xs(num), ys(num);
+			for(unsigned int i = 0; i < num; ++i) {
+				xs[i] = ofRandom(1920);
+				ys[i] = ofRandom(1080);
+			}
+
+			ofxParticleGrid grid(RADIUS * 2);
+			std::vector<unsigned int> results;
+			ofxTimingStats bruteTimes, gridTimes;
+			bruteTimes.setSize(NUM_FRAMES);
+			gridTimes.setSize(NUM_FRAMES);
+			uint64_t bruteCount = 0, gridCount = 0;
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+
+				// brute force
+				uint64_t start = now();
+				bruteCount = 0;
+				float radiusSq = RADIUS * RADIUS;
+				for(unsigned int i = 0; i < num; ++i) {
+					for(unsigned int j = 0; j < num; ++j) {
+						float dx = xs[j] - xs[i];
+						float dy = ys[j] - ys[i];
+						if(dx*dx + dy*dy <= radiusSq) {
+							bruteCount++;
+						}
+					}
+				}
+				bruteTimes.add(since(start));
+
+				// grid, including the rebuild each frame
+				start = now();
+				gridCount = 0;
+				grid.build(xs.data(), ys.data(), num);
+				for(unsigned int i = 0; i < num; ++i) {
+					results.clear();
+					grid.queryRadius(xs[i], ys[i], RADIUS, results);
+					gridCount += results.size();
+				}
+				gridTimes.add(since(start));
+			}
+
+			print(ofToString(num) + " particles brute force", bruteTimes);
+			print(ofToString(num) + " particles grid", gridTimes);
+			print("    speedup " + ofToString(bruteTimes.p50() / gridTimes.p50(), 1) + "x, " +
+			      ofToString(gridCount) + " neighbors" +
+			      (gridCount == bruteCount ? "" : ", MISMATCH: brute force found " +
+			       ofToString(bruteCount)));
+		}
+};
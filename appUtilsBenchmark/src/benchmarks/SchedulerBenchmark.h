@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// 100k pending timers spread over 10 s, run at 60 fps: polling each
+// ofxTimer::alarm() every frame vs ofxTimerScheduler::update()
+class SchedulerBenchmark : public Benchmark {
+
+	public:
+
+		SchedulerBenchmark() : Benchmark("timer scheduler") {}
+
+		static constexpr unsigned int NUM_TIMERS = 100000;
+		static constexpr unsigned int NUM_FRAMES = 600;
+
+		void runBenchmark() {
+			print(ofToString(NUM_TIMERS) + " timers over " +
+			      ofToString(NUM_FRAMES / 60) + " s at 60 fps");
+
+			ofSeedRandom(0);
+			std::vector<uint64_t> alarms(NUM_TIMERS);
+			for(unsigned int i = 0; i < NUM_TIMERS; ++i) {
+				alarms[i] = (uint64_t)ofRandom(1, NUM_FRAMES * 1000 / 60) * 1000000;
+			}
+
+			// polling
+			clock.set(0);
+			std::vector<ofxTimer> timers(NUM_TIMERS);
+			std::vector<bool> fired(NUM_TIMERS, false);
+			unsigned int numPolled = 0;
+			for(unsigned int i = 0; i < NUM_TIMERS; ++i) {
+				timers[i].setAlarmNanos(alarms[i]);
+			}
+			ofxTimingStats pollTimes;
+			pollTimes.setSize(NUM_FRAMES);
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				clock.stepMillis(1000.0 / 60.0);
+				uint64_t start = now();
+				for(unsigned int i = 0; i < NUM_TIMERS; ++i) {
+					if(!fired[i] && timers[i].alarm()) {
+						fired[i] = true;
+						numPolled++;
+					}
+				}
+				pollTimes.add(since(start));
+			}
+			print("polling per frame", pollTimes);
+
+			// scheduler
+			clock.set(0);
+			ofxTimerScheduler scheduler;
+			unsigned int numFired = 0;
+			uint64_t start = now();
+			for(unsigned int i = 0; i < NUM_TIMERS; ++i) {
+				scheduler.addNanos(alarms[i], [&numFired]() {numFired++;});
+			}
+			print("scheduler add all: " + ofToString(since(start), 3) + " ms");
+			ofxTimingStats updateTimes;
+			updateTimes.setSize(NUM_FRAMES);
+			for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+				clock.stepMillis(1000.0 / 60.0);
+				start = now();
+				scheduler.update();
+				updateTimes.add(since(start));
+			}
+			print("scheduler update per frame", updateTimes);
+			print("    fired " + ofToString(numFired) +
+			      (numFired == numPolled ? "" : ", MISMATCH: polling fired " +
+			       ofToString(numPolled)));
+
+			// cancel
+			std::vector<uint64_t> ids(NUM_TIMERS);
+			for(unsigned int i = 0; i < NUM_TIMERS; ++i) {
+				ids[i] = scheduler.addNanos(alarms[i], [&numFired]() {numFired++;});
+			}
+			start = now();
+			for(unsigned int i = 0; i < NUM_TIMERS; i += 10) {
+				scheduler.cancel(ids[i]);
+			}
+			print("scheduler cancel " + ofToString(NUM_TIMERS / 10) + ": " +
+			      ofToString(since(start), 3) + " ms");
+			start = now();
+			scheduler.update();
+			print("    next update: " + ofToString(since(start), 3) + " ms");
+		}
+};
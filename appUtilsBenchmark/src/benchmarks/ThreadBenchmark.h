@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <thread>
+
+#include "Benchmark.h"
+
+// a particle with a bit of math in its update, like a flow field
+class FlowParticle : public ofxParticle {
+
+	public:
+
+		FlowParticle(float x, float y) : ofxParticle(x, y, 4, 4) {}
+
+		void update() {
+			float angle = sinf(x * 0.01f) + cosf(y * 0.01f);
+			for(int i = 0; i < 4; ++i) {
+				angle = sinf(angle) * 2.0f + cosf(angle * 0.5f);
+			}
+			x += cosf(angle);
+			y += sinf(angle);
+		}
+
+		void draw() {}
+};
+
+// ofxParticleManager threaded update scaling from 1 to N cores, the calling
+// thread helps so N cores is a pool with N-1 worker threads
+class ThreadBenchmark : public Benchmark {
+
+	public:
+
+		ThreadBenchmark() : Benchmark("threaded update") {}
+
+		static constexpr unsigned int NUM_PARTICLES = 100000;
+		static constexpr unsigned int NUM_FRAMES = 60;
+		static constexpr unsigned int GRAIN_SIZE = 1024;
+
+		void runBenchmark() {
+			unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+			print(ofToString(NUM_PARTICLES) + " particles, grain size " +
+			      ofToString(GRAIN_SIZE) + ", " + ofToString(cores) + " cores");
+
+			ofxParticleManager manager;
+			ofSeedRandom(0);
+			for(unsigned int i = 0; i < NUM_PARTICLES; ++i) {
+				manager.addParticle(new FlowParticle(ofRandom(1920), ofRandom(1080)));
+			}
+
+			double serial = 0;
+			for(unsigned int n = 1; n <= cores; ++n) {
+				std::unique_ptr<ofxThreadPool> pool;
+				if(n > 1) {
+					pool.reset(new ofxThreadPool(n - 1));
+					manager.setThreadedUpdate(true, GRAIN_SIZE, pool.get());
+				}
+				else {
+					manager.setThreadedUpdate(false);
+				}
+				manager.update(); // warm up
+				ofxTimingStats updateTimes;
+				updateTimes.setSize(NUM_FRAMES);
+				for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+					uint64_t start = now();
+					manager.update();
+					updateTimes.add(since(start));
+				}
+				if(n == 1) {
+					serial = updateTimes.p50();
+				}
+				print(ofToString(n) + " cores update", updateTimes);
+				print("    speedup " + ofToString(serial / updateTimes.p50(), 2) + "x");
+			}
+			manager.setThreadedUpdate(false);
+		}
+};
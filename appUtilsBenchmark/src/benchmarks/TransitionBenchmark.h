@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "Benchmark.h"
+
+// ofxSceneTransition CPU compositing with composite(): checks crossfade,
+// wipe, & dissolve output for known images, then times compositing 1080p
+class TransitionBenchmark : public Benchmark {
+
+	public:
+
+		TransitionBenchmark() : Benchmark("scene transitions") {}
+
+		static constexpr unsigned char FROM = 40; // from image value
+		static constexpr unsigned char TO = 200;  // to image value
+		static constexpr unsigned int NUM_FRAMES = 30;
+
+		void runBenchmark() {
+			runChecks();
+
+			ofPixels from, to, out;
+			from.allocate(1920, 1080, 4);
+			to.allocate(1920, 1080, 4);
+			fill(from, FROM);
+			fill(to, TO);
+			print("1920x1080 RGBA");
+			ofxSceneTransition transition;
+			ofxSceneTransition::Type types[3] = {
+				ofxSceneTransition::CROSSFADE, ofxSceneTransition::WIPE, ofxSceneTransition::DISSOLVE
+			};
+			std::string names[3] = {"crossfade", "wipe", "dissolve"};
+			for(unsigned int i = 0; i < 3; ++i) {
+				transition.setType(types[i]);
+				ofxTimingStats times;
+				times.setSize(NUM_FRAMES);
+				for(unsigned int frame = 0; frame < NUM_FRAMES; ++frame) {
+					uint64_t start = now();
+					transition.composite(from, to, out, (float)frame / (NUM_FRAMES - 1));
+					times.add(since(start));
+				}
+				print(names[i] + " composite", times);
+			}
+		}
+
+	protected:
+
+		void runChecks() {
+			const unsigned int w = 8, h = 4;
+			ofPixels from, to, out;
+			from.allocate(w, h, 3);
+			to.allocate(w, h, 3);
+			fill(from, FROM);
+			fill(to, TO);
+			ofxSceneTransition transition(ofxSceneTransition::CROSSFADE);
+
+			// crossfade blends every pixel
+			transition.composite(from, to, out, 0);
+			check(all(out, FROM), "crossfade at 0 is all from");
+			transition.composite(from, to, out, 0.5);
+			check(all(out, (FROM + TO) / 2), "crossfade at 0.5 is halfway");
+			transition.composite(from, to, out, 1);
+			check(all(out, TO), "crossfade at 1 is all to");
+
+			// wipe edge moves left to right
+			transition.setType(ofxSceneTransition::WIPE);
+			transition.composite(from, to, out, 0);
+			check(all(out, FROM), "wipe at 0 is all from");
+			transition.composite(from, to, out, 0.5);
+			check(columns(out, w / 2), "wipe at 0.5 has the edge at the middle column");
+			transition.composite(from, to, out, 0.25);
+			check(columns(out, w / 4), "wipe at 0.25 has the edge at a quarter");
+			transition.composite(from, to, out, 1);
+			check(all(out, TO), "wipe at 1 is all to");
+
+			// dissolve switches each cell at its threshold, one cell per pixel
+			transition.setType(ofxSceneTransition::DISSOLVE);
+			transition.setDissolveCells(w, h);
+			transition.composite(from, to, out, 0);
+			check(all(out, FROM), "dissolve at 0 is all from");
+			transition.composite(from, to, out, 0.5);
+			bool ok = true;
+			unsigned int numTo = 0;
+			for(unsigned int y = 0; y < h; ++y) {
+				for(unsigned int x = 0; x < w; ++x) {
+					bool isTo = transition.getDissolveThreshold(x, y) < 0.5;
+					ok = ok && pixel(out, x, y) == (isTo ? TO : FROM);
+					numTo += isTo;
+				}
+			}
+			check(ok, "dissolve at 0.5 follows the cell thresholds, " +
+			      ofToString(numTo) + "/" + ofToString(w * h) + " cells revealed");
+			transition.composite(from, to, out, 1);
+			check(all(out, TO), "dissolve at 1 is all to");
+
+			// mismatched images are rejected
+			ofPixels small;
+			small.allocate(w / 2, h, 3);
+			check(!transition.composite(from, small, out, 0.5), "mismatched sizes are rejected");
+		}
+
+		// set all channels of all pixels to a value
+		static void fill(ofPixels &pixels, unsigned char value) {
+			unsigned char *data = pixels.getData();
+			std::fill(data, data + pixels.getWidth() * pixels.getHeight() * pixels.getNumChannels(), value);
+		}
+
+		// get the first channel of a pixel
+		static unsigned char pixel(ofPixels &pixels, unsigned int x, unsigned int y) {
+			return pixels.getData()[(y * pixels.getWidth() + x) * pixels.getNumChannels()];
+		}
+
+		// are all channels of all pixels a value?
+		static bool all(ofPixels &pixels, unsigned char value) {
+			unsigned char *data = pixels.getData();
+			unsigned char *end = data + pixels.getWidth() * pixels.getHeight() * pixels.getNumChannels();
+			return std::find_if(data, end, [value](unsigned char v) {return v != value;}) == end;
+		}
+
+		// are the columns left of the edge to & the rest from?
+		static bool columns(ofPixels &pixels, unsigned int edge) {
+			for(unsigned int y = 0; y < pixels.getHeight(); ++y) {
+				for(unsigned int x = 0; x < pixels.getWidth(); ++x) {
+					if(pixel(pixels, x, y) != (x < edge ? TO : FROM)) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+};
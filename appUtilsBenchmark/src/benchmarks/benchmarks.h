@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "ChurnBenchmark.h"
+#include "BatchBenchmark.h"
+#include "ThreadBenchmark.h"
+#include "GridBenchmark.h"
+#include "EmitterBenchmark.h"
+#include "AudioBenchmark.h"
+#include "SchedulerBenchmark.h"
+#include "TransitionBenchmark.h"
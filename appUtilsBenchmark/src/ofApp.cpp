@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#include "ofApp.h"
+
+#include "benchmarks/benchmarks.h"
+
+//--------------------------------------------------------------
+void ofApp::setup() {
+	ofBackground(0, 0, 0);
+	ofSetFrameRate(60);
+
+	benchmarks.push_back(new ChurnBenchmark());
+	benchmarks.push_back(new BatchBenchmark());
+	benchmarks.push_back(new ThreadBenchmark());
+	benchmarks.push_back(new GridBenchmark());
+	benchmarks.push_back(new EmitterBenchmark());
+	benchmarks.push_back(new AudioBenchmark());
+	benchmarks.push_back(new SchedulerBenchmark());
+	benchmarks.push_back(new TransitionBenchmark());
+	run(-1);
+}
+
+//--------------------------------------------------------------
+void ofApp::update() {
+
+	// run one benchmark per frame so the window shows the progress
+	if(!queue.empty()) {
+		queue.front()->run();
+		queue.pop_front();
+		if(queue.empty()) {
+			save();
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ofApp::draw() {
+	ofSetColor(255);
+	float x = 10, y = 20;
+	for(unsigned int i = 0; i < benchmarks.size(); ++i) {
+		const std::vector<std::string> &results = benchmarks[i]->getResults();
+		if(results.empty()) {
+			bool queued = std::find(queue.begin(), queue.end(), benchmarks[i]) != queue.end();
+			ofDrawBitmapString(ofToString(i + 1) + " " + benchmarks[i]->getName() +
+			                   (queued ? ": waiting..." : ""), x, y);
+			y += 14;
+		}
+		for(unsigned int j = 0; j < results.size(); ++j) {
+			ofDrawBitmapString(results[j], x, y);
+			y += 14;
+		}
+
+		// wrap into a second column
+		if(y > ofGetHeight() - 100 && x < ofGetWidth() / 2) {
+			x = ofGetWidth() / 2 + 10;
+			y = 20;
+		}
+	}
+	if(queue.empty()) {
+		ofDrawBitmapString("'r' to run all again, 1-" + ofToString(benchmarks.size()) +
+		                   " to run one", 10, ofGetHeight() - 10);
+	}
+}
+
+//--------------------------------------------------------------
+void ofApp::exit() {
+	for(unsigned int i = 0; i < benchmarks.size(); ++i) {
+		delete benchmarks[i];
+	}
+	benchmarks.clear();
+	queue.clear();
+}
+
+//--------------------------------------------------------------
+void ofApp::keyPressed(int key) {
+	if(!queue.empty()) {
+		return; // still running
+	}
+	if(key == 'r') {
+		run(-1);
+	}
+	else if(key >= '1' && key < '1' + (int)benchmarks.size()) {
+		run(key - '1');
+	}
+}
+
+//--------------------------------------------------------------
+void ofApp::run(int index) {
+	if(index < 0) {
+		queue.assign(benchmarks.begin(), benchmarks.end());
+	}
+	else {
+		queue.push_back(benchmarks[index]);
+	}
+}
+
+//--------------------------------------------------------------
+void ofApp::save() {
+	std::ofstream file(ofToDataPath("benchmarks.txt", true).c_str());
+	for(unsigned int i = 0; i < benchmarks.size(); ++i) {
+		const std::vector<std::string> &results = benchmarks[i]->getResults();
+		for(unsigned int j = 0; j < results.size(); ++j) {
+			file << results[j] << std::endl;
+		}
+	}
+	ofLogNotice("ofApp") << "saved results to benchmarks.txt";
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "ofMain.h"
+
+#include "ofxAppUtils.h"
+
+class Benchmark;
+
+/// runs the ofxAppUtils performance benchmarks, one per frame, & shows the
+/// results which are also logged & saved to bin/data/benchmarks.txt
+///
+/// build in release mode, debug timings are meaningless
+///
+/// controls:
+///     - 'r' to run all the benchmarks again
+///     - the number keys to run a single benchmark
+///
+class ofApp : public ofBaseApp {
+
+	public:
+
+		void setup();
+		void update();
+		void draw();
+		void exit();
+
+		void keyPressed(int key);
+
+		// queue benchmarks to run, -1 for all
+		void run(int index);
+
+		// save the results of all benchmarks
+		void save();
+
+		std::vector<Benchmark*> benchmarks;
+		std::deque<Benchmark*> queue; // benchmarks left to run
+};
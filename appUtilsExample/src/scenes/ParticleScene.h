@@ -79,7 +79,9 @@ class ParticleScene : public ofxFadeScene {
 			ofSetRectMode(OF_RECTMODE_CENTER);
 			ofSetColor(255, 0, 0, 255*alpha);
 			
-			particles.draw();
+			// draw all particles as rectangles in a single batched mesh,
+			// use particles.draw() to call each particle's draw() instead
+			particles.drawBatched();
 				
 			ofDisableAlphaBlending();
 		}
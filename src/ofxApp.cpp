@@ -14,6 +14,8 @@
 #include "ofAppRunner.h"
 #include "ofLog.h"
 #include "ofxSceneManager.h"
+#include "ofxTimerScheduler.h"
+#include "ofxTrace.h"
 
 // APP
 
@@ -23,10 +25,29 @@ ofxApp::ofxApp() {
 	_bAutoTransforms = true;
 	_bDrawFramerate = true;
 	_framerateColor.set(255);	// white
+	_bDrawFrameStats = true;
 	_transformer = NULL;
 	_sceneManager = NULL;
 	_bSceneManagerUpdate = true;
 	_bSceneManagerDraw = true;
+	_bTimerSchedulerUpdate = true;
+	_bFixedTimestep = false;
+	_timestepMS = 1000.0/60.0;
+	_maxSteps = 5;
+	_numSteps = 0;
+	_accumulator = 0;
+	_interpolation = 1;
+	_wallClock = NULL;
+	_bStepClockReplaced = false;
+	_timestepStamp = 0;
+	_frameStamp = 0;
+}
+
+//--------------------------------------------------------------
+ofxApp::~ofxApp() {
+	if(ofxTimer::getClock() == &_stepClock) {
+		ofxTimer::setClock(_wallClock);
+	}
 }
 
 // TRANSFORMER
@@ -81,6 +102,43 @@ void ofxApp::clearSceneManager() {
 	_sceneManager = NULL;
 }
 
+// FIXED TIMESTEP
+
+//--------------------------------------------------------------
+void ofxApp::setFixedTimestep(bool fixed, double stepMS, unsigned int maxSteps) {
+	if(stepMS <= 0) {
+		ofLogWarning("ofxApp") << "ignoring invalid timestep: " << stepMS;
+		return;
+	}
+
+	// swap in the step clock, starting from the current time, or restore the
+	// clock it replaced
+	if(fixed && ofxTimer::getClock() != &_stepClock) {
+		_wallClock = ofxTimer::getClock();
+		_stepClock.set(ofxTimer::now());
+		ofxTimer::setClock(&_stepClock);
+	}
+	else if(!fixed) {
+		if(ofxTimer::getClock() == &_stepClock) {
+			ofxTimer::setClock(_wallClock);
+		}
+		_wallClock = NULL;
+	}
+	_bStepClockReplaced = false;
+
+	_bFixedTimestep = fixed;
+	_timestepMS = stepMS;
+	_maxSteps = (maxSteps == 0) ? 1 : maxSteps;
+	_accumulator = 0;
+	_interpolation = 1;
+	_timestepStamp = _wallTime();
+}
+
+//--------------------------------------------------------------
+uint64_t ofxApp::_wallTime() {
+	return (_wallClock == NULL) ? ofxSteadyClock::get() : _wallClock->now();
+}
+
 // DRAW FRAMERATE
 
 //--------------------------------------------------------------
@@ -89,6 +147,35 @@ void ofxApp::drawFramerate(float x, float y) {
 	ofDrawBitmapStringHighlight("fps: "+ofToString(ceil(ofGetFrameRate())), x, y);
 }
 
+// FRAME STATS
+
+//--------------------------------------------------------------
+void ofxApp::drawFrameStats(float x, float y, float w, float h) {
+	_frameStats.draw(x, y, w, h);
+	ofSetColor(_framerateColor);
+	ofDrawBitmapStringHighlight("max: "+ofToString(_frameStats.max(), 1)+" ms hitches: "
+		+ofToString(_frameStats.getNumHitches()), x, y+h+14);
+}
+
+//--------------------------------------------------------------
+void ofxApp::_logHitch(float ms) {
+	std::string state;
+	if(_sceneManager) {
+		state = " scene: \""+_sceneManager->getCurrentSceneName()+"\"";
+		ofxScene *scene = _sceneManager->getCurrentScene();
+		if(scene && scene->isEntering()) {
+			state += " entering";
+		}
+		else if(scene && scene->isExiting()) {
+			state += " exiting";
+		}
+		if(_sceneManager->isTransitioning()) {
+			state += " transitioning";
+		}
+	}
+	ofLogWarning("ofxApp") << "frame hitch: " << ms << " ms" << state;
+}
+
 // RUNNER APP
 
 //--------------------------------------------------------------
@@ -110,28 +197,68 @@ void ofxApp::RunnerApp::setup() {
 		app->getTransformer()->setRenderSize(ofGetWidth(), ofGetHeight());
 	}
 	app->setup();
+	app->_frameStamp = ofxSteadyClock::get();
 }
 
 //--------------------------------------------------------------
 void ofxApp::RunnerApp::update() {
+	OFX_TRACE_SCOPE("ofxApp::update");
+
+	// time the whole frame, update to update
+	uint64_t frameStamp = ofxSteadyClock::get();
+	float frameMS = (frameStamp - app->_frameStamp) / 1000000.0;
+	app->_frameStamp = frameStamp;
+	if(app->_frameStats.add(frameMS)) {
+		app->_logHitch(frameMS);
+	}
+
 	app->mouseX = mouseX;
 	app->mouseY = mouseY;
-	if(app->_sceneManager && app->_bSceneManagerUpdate) {
-		app->_sceneManager->update();
+	if(!app->_bFixedTimestep) {
+		_update();
+		return;
 	}
-	app->update();
+
+	// the step clock only works while it's the ofxTimer clock
+	if(ofxTimer::getClock() != &app->_stepClock && !app->_bStepClockReplaced) {
+		ofLogWarning("ofxApp") << "ofxTimer clock replaced while using a fixed timestep, "
+			<< "timers no longer see fixed steps, call setFixedTimestep() to reinstall";
+		app->_bStepClockReplaced = true;
+	}
+
+	// run as many fixed steps as fit in the elapsed time
+	uint64_t now = app->_wallTime();
+	if(now > app->_timestepStamp) {
+		app->_accumulator += (now - app->_timestepStamp) / 1000000.0;
+	}
+	app->_timestepStamp = now;
+	app->_numSteps = 0;
+	while(app->_accumulator >= app->_timestepMS && app->_numSteps < app->_maxSteps) {
+		app->_stepClock.stepMillis(app->_timestepMS); // timers see exactly one step
+		_update();
+		app->_accumulator -= app->_timestepMS;
+		app->_numSteps++;
+	}
+
+	// too far behind? drop the extra time instead of catching up later
+	if(app->_accumulator >= app->_timestepMS) {
+		app->_accumulator = fmod(app->_accumulator, app->_timestepMS);
+	}
+	app->_interpolation = app->_accumulator / app->_timestepMS;
 }
 
 //--------------------------------------------------------------
 void ofxApp::RunnerApp::draw() {
+	OFX_TRACE_SCOPE("ofxApp::draw");
 	
 	// push transforms
 	if(app->_bAutoTransforms && app->_transformer) {
 		app->_transformer->push(app->_transformer->getEditWarp());
 	}
 	
-	// draw scene
+	// draw scene, transitions are drawn at the render size
 	if(app->_sceneManager && app->_bSceneManagerDraw) {
+		app->_sceneManager->setTransitionSize(app->getRenderWidth(), app->getRenderHeight());
 		app->_sceneManager->draw();
 	}
 		
@@ -153,9 +280,26 @@ void ofxApp::RunnerApp::draw() {
 		if(app->_bDrawFramerate) {
 			app->drawFramerate(ofGetWidth()-60, ofGetHeight()-6);
 		}
+		if(app->_bDrawFrameStats) {
+			app->drawFrameStats(ofGetWidth()-190, ofGetHeight()-80, 180, 40);
+		}
+		if(app->_sceneManager && app->_sceneManager->getProfiling()) {
+			app->_sceneManager->drawProfile(8, 14);
+		}
 	}
 }
 
+//--------------------------------------------------------------
+void ofxApp::RunnerApp::_update() {
+	if(app->_bTimerSchedulerUpdate) {
+		ofxTimerScheduler::shared().update();
+	}
+	if(app->_sceneManager && app->_bSceneManagerUpdate) {
+		app->_sceneManager->update();
+	}
+	app->update();
+}
+
 //--------------------------------------------------------------
 void ofxApp::RunnerApp::exit() {
 	app->exit();
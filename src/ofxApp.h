@@ -21,6 +21,7 @@
 #include "ofxQuadWarper.h"
 #include "ofxTransformer.h"
 #include "ofxTimer.h"
+#include "ofxFrameStats.h"
 
 class ofxSceneManager;
 
@@ -42,7 +43,7 @@ class ofxApp :
 	public:
 	
 		ofxApp();
-		virtual ~ofxApp() {}
+		virtual ~ofxApp();
 		
 	/// \section Transformer
 		
@@ -110,6 +111,60 @@ class ofxApp :
 		void setSceneManagerDraw(bool draw)     {_bSceneManagerDraw = draw;}
 		bool getSceneManagerDraw()              {return _bSceneManagerDraw;}
 
+	/// \section Timer Scheduler
+
+		/// enable/disable the automatic shared ofxTimerScheduler update (on by
+		/// default), called before the scene manager update so scheduled alarms
+		/// fire once per frame, or once per step when using a fixed timestep
+		///
+		/// disable this to call ofxTimerScheduler::shared().update() manually
+		void setTimerSchedulerUpdate(bool update) {_bTimerSchedulerUpdate = update;}
+		bool getTimerSchedulerUpdate()            {return _bTimerSchedulerUpdate;}
+
+	/// \section Fixed Timestep
+
+		/// enable/disable fixed timestep updates (off by default)
+		///
+		/// when enabled, the scene manager & app update functions are called
+		/// once per elapsed time step instead of once per frame, up to maxSteps
+		/// times per frame, any time left over after maxSteps is dropped so
+		/// long frames do not snowball
+		///
+		/// while enabled, the app sets its own ofxManualClock as the ofxTimer
+		/// clock & steps it by exactly stepMS before each update, so everything
+		/// timed with ofxTimer (scene fades & transitions, particle ages &
+		/// emitters, scheduled alarms, etc) sees one fixed step per update, the
+		/// elapsed frame time is measured with the clock which was set before
+		///
+		/// note: running ofxTimers should be reset after enabling or disabling,
+		///       as the fixed step clock falls behind by any dropped time
+		///
+		/// note: don't call ofxTimer::setClock() while enabled, a warning is
+		///       logged if the step clock is replaced, call this again to
+		///       reinstall it on top of the new clock
+		///
+		/// stepMS is the time step in ms, default: 60 updates per second
+		void setFixedTimestep(bool fixed, double stepMS=1000.0/60.0, unsigned int maxSteps=5);
+		bool getFixedTimestep() {return _bFixedTimestep;}
+
+		/// get the time step in ms, this is how much time passes for each update
+		/// when using a fixed timestep
+		double getTimestep() {return _timestepMS;}
+
+		/// get the max number of updates per frame
+		unsigned int getMaxSteps() {return _maxSteps;}
+
+		/// get the number of updates run for the current frame
+		unsigned int getNumSteps() {return _numSteps;}
+
+		/// get how far between the last & next update the current frame is,
+		/// normalized 0-1, use this in draw() to interpolate positions:
+		///
+		///     float x = ofLerp(prevX, currentX, getInterpolation());
+		///
+		/// note: always 1 when not using a fixed timestep
+		float getInterpolation() {return _interpolation;}
+
 	/// \section Drawing the Framerate (as text, default lower right corner)
 
 		/// draw the framerate automatically in debug mode? (on by default)
@@ -121,6 +176,24 @@ class ofxApp :
 		
 		/// draw the framerate text manually
 		void drawFramerate(float x, float y);
+
+	/// \section Frame Stats (sparkline & hitches, default lower right corner)
+
+		/// draw the frame time sparkline automatically in debug mode? (on by default)
+		void setDrawFrameStats(bool draw) {_bDrawFrameStats = draw;}
+		bool getDrawFrameStats()          {return _bDrawFrameStats;}
+
+		/// reference to the frame time stats, each update to update time is
+		/// added & hitches are logged with the current scene & transition state
+		///
+		/// frames are timed with the steady system clock, so real stalls are
+		/// seen even when a manual clock or fixed timestep is used
+		///
+		/// set the hitch threshold with getFrameStats().setHitchThreshold(ms)
+		ofxFrameStats& getFrameStats() {return _frameStats;}
+
+		/// draw the frame time sparkline, longest frame, & hitch count manually
+		void drawFrameStats(float x, float y, float w, float h);
 	
 	/// \section Util
 			
@@ -140,11 +213,33 @@ class ofxApp :
 		
 		bool _bDrawFramerate; //< draw the dramerate in debug mode? default: true
 		ofColor _framerateColor; //< framerate text color
+
+		/// log a hitch frame with the current scene & transition state
+		void _logHitch(float ms);
+
+		bool _bDrawFrameStats; //< draw the frame stats in debug mode? default: true
+		ofxFrameStats _frameStats; //< frame time histogram & hitches
+		uint64_t _frameStamp; //< steady clock time of the last frame in ns
 		
 		ofxSceneManager *_sceneManager; //< optional built in scene manager
 		bool _bSceneManagerUpdate; //< call scene manager update automatically?
 		bool _bSceneManagerDraw; //< call scene manager draw automatically?
 
+		bool _bTimerSchedulerUpdate; //< update the shared timer scheduler automatically?
+		bool _bFixedTimestep; //< update at a fixed timestep?
+		double _timestepMS; //< fixed timestep length in ms
+		unsigned int _maxSteps; //< max number of fixed updates per frame
+		unsigned int _numSteps; //< number of fixed updates for the current frame
+		double _accumulator; //< time not yet used by fixed updates in ms
+		float _interpolation; //< normalized time between fixed updates
+		ofxManualClock _stepClock; //< ofxTimer clock stepped once per fixed update
+		ofxClock *_wallClock; //< clock set before the step clock, NULL for the default
+		bool _bStepClockReplaced; //< was the step clock replaced while in use?
+		uint64_t _timestepStamp; //< wall clock time of the last fixed update frame in ns
+
+		/// get the current wall clock time in ns
+		uint64_t _wallTime();
+
 	public:
 
 		/// wrapper used to handle ofxApp magic behind the scenes ...
@@ -213,6 +308,9 @@ class ofxApp :
 				ofxApp* getAppPtr() {return app;}
 				
 			private:
+
+				/// call the scene manager & app updates
+				void _update();
 			
 				ofxApp *app;
 		};
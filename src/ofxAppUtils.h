@@ -15,10 +15,24 @@
 #include "ofxApp.h"
 #include "ofxScene.h"
 #include "ofxSceneManager.h"
+#include "ofxSceneTransition.h"
+#include "ofxSceneProfile.h"
+#include "ofxClock.h"
 #include "ofxTimer.h"
+#include "ofxTimerScheduler.h"
 #include "ofxMovingAverage.h"
+#include "ofxMovingStats.h"
+#include "ofxThreadedMovingAverage.h"
 #include "ofxParticleManager.h"
+#include "ofxParticlePool.h"
+#include "ofxParticleBatch.h"
+#include "ofxParticleGrid.h"
+#include "ofxParticleIntegrator.h"
+#include "ofxParticleEmitter.h"
 #include "ofxBitmapString.h"
+#include "ofxThreadPool.h"
+#include "ofxTrace.h"
+#include "ofxFrameStats.h"
 
 /// replace ofRunApp with this in main.cpp, make sure to call ofxGetAppPtr()
 /// instead of ofGetAppPtr() if you need access to the global ofxApp pointer
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+
+///	\class	Clock
+///	\brief	a clock time source in ns, inherit this to provide your own time
+///
+/// set the clock used by ofxTimer (and everything timed with it) with
+/// ofxTimer::setClock()
+///
+/// note: now() is called from worker threads (threaded particle updates,
+///       parallel scene layers, etc), so it must be thread safe
+class ofxClock {
+	public:
+
+		virtual ~ofxClock() {}
+
+		/// get the current time in ns
+		virtual uint64_t now() = 0;
+};
+
+///	\class	SteadyClock
+///	\brief	the monotonic system clock, this is the default
+class ofxSteadyClock : public ofxClock {
+	public:
+
+		uint64_t now() {return get();}
+
+		/// get the current monotonic system time in ns
+		static inline uint64_t get() {
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+};
+
+///	\class	ManualClock
+///	\brief	a virtual clock which only moves when stepped
+///
+/// use this to run at a fixed timestep independent of wall time, ie. to run
+/// a show faster than real time for testing or to render frames offline:
+///
+///     ofxManualClock clock;
+///     ofxTimer::setClock(&clock);
+///
+///     // in update(), advance 1/60 of a second per frame
+///     clock.stepMillis(1000.0/60.0);
+///
+class ofxManualClock : public ofxClock {
+	public:
+
+		/// start time in ns
+		ofxManualClock(uint64_t start=0) : time(start) {}
+
+		uint64_t now() {return time.load(std::memory_order_acquire);}
+
+		/// move the clock forward by ns
+		void step(uint64_t ns) {time.fetch_add(ns, std::memory_order_acq_rel);}
+
+		/// move the clock forward by ms, negative & NaN times are ignored as
+		/// the clock can't go backwards
+		void stepMillis(double ms) {
+			if(ms > 0) {
+				step((uint64_t)(ms * 1000000.0));
+			}
+		}
+
+		/// set the current time in ns
+		void set(uint64_t ns) {time.store(ns, std::memory_order_release);}
+
+	protected:
+
+		std::atomic<uint64_t> time; //< current time in ns, read from any thread
+};
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "ofGraphics.h"
+#include "ofVboMesh.h"
+#include "ofxMovingStats.h"
+
+///	\class  ofxFrameStats
+///	\brief  rolling frame time histogram, hitch detection, & sparkline
+///
+/// keeps the last N frame times in an ofxMovingStats window along with a
+/// histogram of them which is updated as frames are added and leave the window
+///
+/// a hitch is a frame which took longer than the hitch threshold
+///
+/// usage:
+///
+///     // in update()
+///     if(frameStats.add(ofGetLastFrameTime() * 1000)) {
+///         ofLogWarning() << "hitch: " << frameStats.last() << " ms";
+///     }
+///
+///     // in draw()
+///     frameStats.draw(10, 10, 120, 40);
+///
+class ofxFrameStats {
+
+	public:
+
+		/// max window size in frames
+		static const std::size_t CAPACITY = 600;
+
+		/// specified window size in frames, clamped to the capacity
+		ofxFrameStats(unsigned int size=120) : hitchThreshold(50), numHitches(0) {
+			mesh.setMode(OF_PRIMITIVE_LINE_STRIP);
+			mesh.setUsage(GL_STREAM_DRAW);
+			setHistogram(25, 2);
+			setSize(size);
+		}
+		virtual ~ofxFrameStats() {}
+
+	/// \section Frames
+
+		/// add a frame time in ms, returns true if the frame is a hitch
+		bool add(float ms) {
+			if(!(ms > 0)) { // also catches NaN, which would stick in the stats
+				ms = 0;
+			}
+			if(times.isFull()) { // remove the oldest from the histogram
+				bins[_bin(times.get(0))]--;
+			}
+			times.add(ms);
+			bins[_bin(ms)]++;
+			if(ms > hitchThreshold) {
+				numHitches++;
+				return true;
+			}
+			return false;
+		}
+
+		/// get the newest frame time in ms, 0 if empty
+		float last() {return times.last();}
+
+		/// get the longest frame time in the window in ms, 0 if empty
+		float max() {return times.max();}
+
+		/// get the average frame time in the window in ms, 0 if empty
+		float avg() {return times.avg();}
+
+		/// get the number of frames in the window
+		unsigned int getCount() {return times.getCount();}
+
+		/// set (resize) the window size in frames, clamped to the capacity,
+		/// clears the current frames
+		void setSize(unsigned int size) {
+			times.setSize((size > 0) ? size : 1);
+			mesh.getVertices().reserve(times.size());
+			mesh.getColors().reserve(times.size());
+			clear();
+		}
+
+		/// get the window size in frames
+		unsigned int size() {return times.size();}
+
+		/// get the moving window of frame times
+		ofxMovingStats<float, CAPACITY>& getTimes() {return times;}
+
+		/// clear the current frames, histogram, & hitch count
+		void clear() {
+			times.clear();
+			numHitches = 0;
+			std::fill(bins.begin(), bins.end(), 0);
+		}
+
+	/// \section Histogram
+
+		/// set the number of histogram bins & the bin width in ms, the last bin
+		/// also counts all longer frames, clears the current frames
+		void setHistogram(unsigned int numBins, float binWidthMS) {
+			bins.assign((numBins > 0) ? numBins : 1, 0);
+			binWidth = (binWidthMS > 0) ? binWidthMS : 1;
+			clear();
+		}
+
+		/// get the number of frames in the window within a bin
+		unsigned int getBin(unsigned int bin) {
+			return (bin < bins.size()) ? bins[bin] : 0;
+		}
+
+		/// get the number of histogram bins
+		unsigned int getNumBins() {return bins.size();}
+
+		/// get the histogram bin width in ms
+		float getBinWidth() {return binWidth;}
+
+	/// \section Hitches
+
+		/// get/set the frame time in ms above which a frame is a hitch,
+		/// default: 50
+		void setHitchThreshold(float ms) {hitchThreshold = ms;}
+		float getHitchThreshold()        {return hitchThreshold;}
+
+		/// get the number of hitches since the last clear
+		unsigned int getNumHitches() {return numHitches;}
+
+	/// \section Draw
+
+		/// draw the window frame times as a sparkline, oldest to newest,
+		/// hitches are drawn in red
+		///
+		/// the height is scaled to fit the longest frame or 1.5x the hitch
+		/// threshold, whichever is larger
+		void draw(float x, float y, float w, float h) {
+			unsigned int count = times.getCount();
+			if(count < 2) {
+				return;
+			}
+			float scale = h / std::max(std::max(max(), hitchThreshold * 1.5f), 1.0f);
+			float step = w / (times.size() - 1);
+			std::vector<ofDefaultVertexType> &verts = mesh.getVertices();
+			std::vector<ofFloatColor> &colors = mesh.getColors();
+			verts.resize(count);
+			colors.resize(count);
+			for(unsigned int i = 0; i < count; ++i) {
+				float ms = times.get(i);
+				verts[i] = ofDefaultVertexType(x + step * i, y + h - ms * scale, 0);
+				colors[i] = (ms > hitchThreshold) ? ofFloatColor(1, 0, 0) : ofFloatColor(1, 1, 1);
+			}
+			mesh.draw();
+		}
+
+	protected:
+
+		/// get the histogram bin for a frame time
+		inline unsigned int _bin(float ms) {
+			float bin = ms / binWidth;
+			if(!(bin > 0)) { // also catches NaN
+				return 0;
+			}
+			return (bin < bins.size()) ? (unsigned int) bin : bins.size() - 1;
+		}
+
+		ofxMovingStats<float, CAPACITY> times; //< moving window of frame times in ms
+
+		std::vector<unsigned int> bins; //< histogram frame counts
+		float binWidth; //< histogram bin width in ms
+
+		float hitchThreshold;    //< hitch frame time in ms
+		unsigned int numHitches; //< hitches since the last clear
+
+		ofVboMesh mesh; //< sparkline line strip
+};
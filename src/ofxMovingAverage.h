@@ -14,8 +14,18 @@
 #pragma once
  
 #include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define OFX_MOVING_AVERAGE_SSE
+#endif
 
 /// a simple moving average https://en.wikipedia.org/wiki/Moving_average
+///
+/// values are kept in a fixed size circular buffer so adding is O(1), the sum
+/// uses Kahan summation to avoid drifting over long running times
 class ofxMovingAverage {
 
 	public:
@@ -23,37 +33,59 @@ class ofxMovingAverage {
 		/// default window size: 10
 		ofxMovingAverage() {
 			windowSize = 10;
-			sum = 0.0;
-			value = 0.0;
-			bUpdateValue = false;
+			window.resize(windowSize);
+			clear();
 		}
 		 
 		/// specified window size
 		ofxMovingAverage(unsigned int windowSize) {
 			this->windowSize = windowSize;
-			sum = 0.0;
-			value = 0.0;
-			bUpdateValue = false;
+			window.resize(windowSize);
+			clear();
 		}
 	 
 		/// add a new number to the window
 		void add(double val) {
-			sum += val;
-			window.push_back(val);
-			if(window.size() > windowSize) { // pop front
-				sum -= window.front();
-				window.erase(window.begin());
+			if(windowSize == 0) {
+				return;
+			}
+			if(count == windowSize) { // replace oldest
+				_sum(-window[head]);
+			}
+			else {
+				count++;
 			}
+			window[head] = val;
+			_sum(val);
+			head = (head + 1) % windowSize;
 			bUpdateValue = true;
 		}
 	 
+		/// add a buffer of numbers to the window, ie. an audio buffer,
+		/// only the newest values are kept if n is larger than the window size
+		///
+		/// the window is updated in bulk with vectorized sums
+		///
+		/// note: the values must be a single channel, ofSoundBuffer samples are
+		///       interleaved so use one average per channel
+		///
+		/// usage with an ofSoundBuffer, in audioIn():
+		///
+		///     for(size_t c = 0; c < buffer.getNumChannels(); ++c) {
+		///         buffer.getChannel(channelBuffer, c); // reused ofSoundBuffer
+		///         avgs[c].add(channelBuffer.getBuffer().data(), channelBuffer.size());
+		///     }
+		///
+		void add(const double *vals, unsigned int n) {_add(vals, n);}
+		void add(const float *vals, unsigned int n)  {_add(vals, n);}
+	 
 		/// get the average value
 		double avg() {
-			if(window.size() == 0) {
+			if(count == 0) {
 				return 0; // technically the average is undefined
 			}
 			if(bUpdateValue) { // avoid unnecessary divisions
-				value = sum / window.size();
+				value = sum / count;
 				bUpdateValue = false;
 			}
 			return value;
@@ -91,14 +123,22 @@ class ofxMovingAverage {
 		double operator*=(const int &i) {add(i * avg()); return avg();}
 		double operator/=(const int &i) {add(i / avg()); return avg();}
 	
-		/// set (resize) the window size
+		/// set (resize) the window size, keeps the newest values
 		void setSize(unsigned int windowSize) {
-			// make smaller? remove items from the front
-			while(window.size() > windowSize) {
-				sum -= window.front();
-				window.erase(window.begin());
+			unsigned int keep = std::min(count, windowSize);
+			std::vector<double> values(windowSize);
+			for(unsigned int i = 0; i < keep; ++i) {
+				values[i] = window[(head + this->windowSize - keep + i) % this->windowSize];
 			}
+			window.swap(values);
 			this->windowSize = windowSize;
+			count = keep;
+			head = (windowSize == 0) ? 0 : keep % windowSize;
+			sum = 0.0;
+			compensation = 0.0;
+			for(unsigned int i = 0; i < count; ++i) {
+				_sum(window[i]);
+			}
 			bUpdateValue = true;
 		}
 	 
@@ -109,17 +149,125 @@ class ofxMovingAverage {
 	 
 		/// clear the window and current sum
 		void clear() {
-			window.clear();
+			head = 0;
+			count = 0;
 			sum = 0.0;
+			compensation = 0.0;
 			value = 0.0;
 			bUpdateValue = false;
 		}
  
 	protected:
 
+		/// bulk add, evicted & added values are summed as blocks
+		template <typename T>
+		void _add(const T *vals, unsigned int n) {
+			if(windowSize == 0 || n == 0 || vals == NULL) {
+				return;
+			}
+
+			// replace the whole window
+			if(n >= windowSize) {
+				std::copy(vals + (n - windowSize), vals + n, window.begin());
+				head = 0;
+				count = windowSize;
+				sum = 0.0;
+				compensation = 0.0;
+				_sum(_blockSum(window.data(), windowSize));
+				bUpdateValue = true;
+				return;
+			}
+
+			// remove the oldest values which will be overwritten
+			unsigned int evict = (count + n > windowSize) ? count + n - windowSize : 0;
+			if(evict > 0) {
+				unsigned int oldest = (head + windowSize - count) % windowSize;
+				unsigned int first = std::min(evict, windowSize - oldest);
+				double removed = _blockSum(window.data() + oldest, first);
+				removed += _blockSum(window.data(), evict - first);
+				_sum(-removed);
+			}
+
+			// write the new values, wrapping around the end
+			unsigned int first = std::min(n, windowSize - head);
+			std::copy(vals, vals + first, window.begin() + head);
+			std::copy(vals + first, vals + n, window.begin());
+			_sum(_blockSum(vals, n));
+
+			head = (head + n) % windowSize;
+			count = std::min(count + n, windowSize);
+			bUpdateValue = true;
+		}
+
+		/// sum a block of values
+		static double _blockSum(const double *vals, unsigned int n) {
+			unsigned int i = 0;
+		#ifdef OFX_MOVING_AVERAGE_SSE
+			__m128d a = _mm_setzero_pd(), b = _mm_setzero_pd();
+			for(; i + 4 <= n; i += 4) {
+				a = _mm_add_pd(a, _mm_loadu_pd(vals + i));
+				b = _mm_add_pd(b, _mm_loadu_pd(vals + i + 2));
+			}
+			double lanes[2];
+			_mm_storeu_pd(lanes, _mm_add_pd(a, b));
+			double total = lanes[0] + lanes[1];
+		#else
+			double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+			for(; i + 4 <= n; i += 4) {
+				s0 += vals[i];
+				s1 += vals[i+1];
+				s2 += vals[i+2];
+				s3 += vals[i+3];
+			}
+			double total = (s0 + s1) + (s2 + s3);
+		#endif
+			for(; i < n; ++i) {
+				total += vals[i];
+			}
+			return total;
+		}
+		static double _blockSum(const float *vals, unsigned int n) {
+			unsigned int i = 0;
+		#ifdef OFX_MOVING_AVERAGE_SSE
+			__m128d a = _mm_setzero_pd(), b = _mm_setzero_pd();
+			for(; i + 4 <= n; i += 4) {
+				__m128 f = _mm_loadu_ps(vals + i);
+				a = _mm_add_pd(a, _mm_cvtps_pd(f));
+				b = _mm_add_pd(b, _mm_cvtps_pd(_mm_movehl_ps(f, f)));
+			}
+			double lanes[2];
+			_mm_storeu_pd(lanes, _mm_add_pd(a, b));
+			double total = lanes[0] + lanes[1];
+		#else
+			double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+			for(; i + 4 <= n; i += 4) {
+				s0 += vals[i];
+				s1 += vals[i+1];
+				s2 += vals[i+2];
+				s3 += vals[i+3];
+			}
+			double total = (s0 + s1) + (s2 + s3);
+		#endif
+			for(; i < n; ++i) {
+				total += vals[i];
+			}
+			return total;
+		}
+
+		/// add to the sum using Kahan summation
+		inline void _sum(double val) {
+			double y = val - compensation;
+			double t = sum + y;
+			compensation = (t - sum) - y;
+			sum = t;
+		}
+
 		unsigned int windowSize; //< window size
-		vector<double> window;   //< current values
+		std::vector<double> window; //< circular buffer of current values
+		unsigned int head;       //< next write position in the window
+		unsigned int count;      //< number of values in the window
 		double sum;              //< current value sum
+		double compensation;     //< Kahan summation running compensation
 		double value;            //< current averaged value
 		bool bUpdateValue;       //< does the value need to be updated?
 };
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/// moving window statistics: mean, variance, standard deviation, min & max
+///
+/// storage is a fixed std::array with a compile-time capacity, so adding never
+/// allocates, the window size can be set at runtime up to the capacity
+///
+/// mean & variance are updated in O(1) using Welford's algorithm, min & max
+/// use monotonic queues for amortized O(1) updates
+///
+/// usage:
+///
+///     ofxMovingStats<float, 120> frameTimes; // 120 sample window
+///     frameTimes.add(ofGetLastFrameTime());
+///     float worst = frameTimes.max();
+///
+template <typename T, std::size_t N>
+class ofxMovingStats {
+
+	public:
+
+		/// window size defaults to the capacity
+		ofxMovingStats() : windowSize(N) {
+			clear();
+		}
+
+		/// specified window size, clamped to the capacity
+		ofxMovingStats(std::size_t windowSize) {
+			setSize(windowSize);
+		}
+
+		/// add a new value to the window
+		void add(T val) {
+			if(windowSize == 0) {
+				return;
+			}
+			double x = (double) val;
+			if(count < windowSize) { // grow
+				count++;
+				double delta = x - mean;
+				mean += delta / count;
+				m2 += delta * (x - mean);
+			}
+			else { // replace oldest
+				double old = (double) window[head];
+				double oldMean = mean;
+				mean += (x - old) / count;
+				m2 += (x - old) * (x - mean + old - oldMean);
+				if(m2 < 0) { // rounding
+					m2 = 0;
+				}
+			}
+			window[head] = val;
+			head = (head + 1) % windowSize;
+			minQueue.push(val, seq, windowSize);
+			maxQueue.push(val, seq, windowSize);
+			seq++;
+		}
+
+		/// get the mean (average) value, 0 if empty
+		double avg() {return mean;}
+
+		/// get the population variance, 0 if empty
+		double variance() {
+			return (count == 0) ? 0 : m2 / count;
+		}
+
+		/// get the population standard deviation, 0 if empty
+		double stddev() {
+			return std::sqrt(variance());
+		}
+
+		/// get the min & max values in the window, T() if empty
+		T min() {return minQueue.front();}
+		T max() {return maxQueue.front();}
+
+		/// get the newest value, T() if empty
+		T last() {
+			return (count == 0) ? T() : window[(head + windowSize - 1) % windowSize];
+		}
+
+		/// get a value in the window by age, 0 is the oldest,
+		/// T() if out of range
+		T get(std::size_t index) {
+			if(index >= count) {
+				return T();
+			}
+			return window[(head + windowSize - count + index) % windowSize];
+		}
+
+		/// set (resize) the window size, clamped to the capacity,
+		/// note: clears the current values
+		void setSize(std::size_t windowSize) {
+			this->windowSize = (windowSize > N) ? N : windowSize;
+			clear();
+		}
+
+		/// get the window size
+		std::size_t size() {return windowSize;}
+
+		/// get the compile-time capacity
+		static constexpr std::size_t capacity() {return N;}
+
+		/// get the number of values in the window
+		std::size_t getCount() {return count;}
+
+		/// is the window full?
+		bool isFull() {return count == windowSize;}
+
+		/// clear the window
+		void clear() {
+			head = 0;
+			count = 0;
+			seq = 0;
+			mean = 0;
+			m2 = 0;
+			minQueue.clear();
+			maxQueue.clear();
+		}
+
+	protected:
+
+		/// fixed capacity monotonic queue of (value, sequence) pairs,
+		/// the front is always the min (or max) of the window
+		template <bool bMax>
+		class MonotonicQueue {
+			public:
+
+				void push(T val, uint64_t seq, std::size_t windowSize) {
+
+					// drop values that left the window
+					while(num > 0 && entries[first].seq + windowSize <= seq) {
+						first = (first + 1) % N;
+						num--;
+					}
+
+					// drop values that can no longer be the min/max
+					while(num > 0) {
+						T &back = entries[(first + num - 1) % N].value;
+						if(bMax ? (back > val) : (back < val)) {
+							break;
+						}
+						num--;
+					}
+
+					Entry &entry = entries[(first + num) % N];
+					entry.value = val;
+					entry.seq = seq;
+					num++;
+				}
+
+				T front() {
+					return (num == 0) ? T() : entries[first].value;
+				}
+
+				void clear() {
+					first = 0;
+					num = 0;
+				}
+
+			private:
+
+				struct Entry {
+					T value;
+					uint64_t seq;
+				};
+
+				std::array<Entry, N> entries; //< circular buffer
+				std::size_t first; //< front position
+				std::size_t num;   //< number of entries
+		};
+
+		std::array<T, N> window; //< circular buffer of current values
+		std::size_t windowSize;  //< current window size <= N
+		std::size_t head;        //< next write position
+		std::size_t count;       //< number of values in the window
+		uint64_t seq;            //< sequence number of the next value
+
+		double mean; //< current mean
+		double m2;   //< sum of squared differences from the mean
+
+		MonotonicQueue<false> minQueue; //< window min tracking
+		MonotonicQueue<true> maxQueue;  //< window max tracking
+};
+
+/// an exponential moving average https://en.wikipedia.org/wiki/Moving_average
+///
+/// newer values are weighted by alpha: avg += alpha * (val - avg),
+/// keeps no history so it's cheap for smoothing sensors, etc
+template <typename T>
+class ofxExponentialMovingAverage {
+
+	public:
+
+		/// alpha is the weight of new values between 0 and 1,
+		/// higher values react faster, default: 0.1
+		ofxExponentialMovingAverage(double alpha=0.1) : value(0), bStarted(false) {
+			setAlpha(alpha);
+		}
+
+		/// add a new value, the first value sets the average
+		void add(T val) {
+			if(!bStarted) {
+				value = (double) val;
+				bStarted = true;
+			}
+			else {
+				value += alpha * ((double) val - value);
+			}
+		}
+
+		/// get the average value, 0 if empty
+		double avg() {return value;}
+
+		/// get/set the new value weight, clamped between 0 and 1
+		void setAlpha(double alpha) {
+			this->alpha = (alpha < 0) ? 0 : ((alpha > 1) ? 1 : alpha);
+		}
+		double getAlpha() {return alpha;}
+
+		/// set the weight to approximate a moving average over a number of values,
+		/// alpha = 2 / (period + 1)
+		void setPeriod(unsigned int period) {
+			setAlpha(2.0 / (period + 1.0));
+		}
+
+		/// clear the current average
+		void clear() {
+			value = 0;
+			bStarted = false;
+		}
+
+	protected:
+
+		double alpha; //< new value weight
+		double value; //< current averaged value
+		bool bStarted; //< has the first value been added?
+};
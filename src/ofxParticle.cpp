@@ -13,25 +13,25 @@
 unsigned int ofxParticle::_frameTimeout = 500;
 
 //--------------------------------------------------------------
-ofxParticle::ofxParticle() : ofRectangle(), bAlive(false), lifespan(0), age(0) {
+ofxParticle::ofxParticle() : ofRectangle(), bAlive(false), lifespan(0), age(0), ageStamp(0), bAutoAged(false) {
 	reset();
 }
 
 //--------------------------------------------------------------
 ofxParticle::ofxParticle(float x, float y, float w, float h) :
-	ofRectangle(x, y, w, h), bAlive(false), lifespan(0), age(0) {
+	ofRectangle(x, y, w, h), bAlive(false), lifespan(0), age(0), ageStamp(0), bAutoAged(false) {
 	reset();
 }
 
 //--------------------------------------------------------------
 ofxParticle::ofxParticle(ofPoint pos, float w, float h) : 
-	ofRectangle(pos.x, pos.y, w, h), bAlive(false), lifespan(0), age(0) {
+	ofRectangle(pos.x, pos.y, w, h), bAlive(false), lifespan(0), age(0), ageStamp(0), bAutoAged(false) {
 	reset();
 }
 		
 //--------------------------------------------------------------
 ofxParticle::ofxParticle(ofRectangle rect) : 
-	ofRectangle(rect), bAlive(false), lifespan(0), age(0) {
+	ofRectangle(rect), bAlive(false), lifespan(0), age(0), ageStamp(0), bAutoAged(false) {
 	reset();
 }
 
@@ -49,26 +49,38 @@ ofxParticle& ofxParticle::operator=(const ofxParticle &from) {
 	bAlive = from.bAlive;
 	lifespan = from.lifespan;
 	age = from.age;
+	ageStamp = from.ageStamp;
+	bAutoAged = from.bAutoAged;
 	return *this;
 }
 
 //--------------------------------------------------------------
 void ofxParticle::updateAge() {
+	if(bAutoAged) {
+		return;
+	}
+	uint64_t now = ofxTimer::now();
+	double diff = (now > ageStamp) ? (now - ageStamp) / 1000000.0 : 0;
+	ageStamp = now;
+	updateAge(diff);
+}
+
+//--------------------------------------------------------------
+void ofxParticle::updateAge(double diff) {
 	if(!bAlive) {
 		return;
 	}
 
 	// ignore if time from last frame was too long
-	if(lifeTimer.getDiff() < _frameTimeout) {
+	if(diff < _frameTimeout) {
 		// increase age by diff in time from last frame
-		age += lifeTimer.getDiff();
+		age += diff;
 
 		// check if too old
-		if(age >= lifespan) {
+		if(lifespan > 0 && age >= lifespan) {
 			kill();
 		}
 	}
-	lifeTimer.set();
 }
 
 //--------------------------------------------------------------
@@ -34,14 +34,22 @@ class ofxParticle : public ofRectangle {
 
 	/// \section Main
 
-		/// update the particles age, ignores time between frames longer then
-		/// the frame timeout
+		/// legacy: update the particles age by the time since the last call,
+		/// ignores time between calls longer then the frame timeout
 		///
-		/// note: make sure to call this in your update() or the age will not
-		///       change
+		/// reads the clock for every particle, so it's only meant for particles
+		/// which are not in an ofxParticleManager or when its auto aging is off,
+		/// does nothing while the particle is auto aged by an ofxParticleManager
+		/// (the default)
 		///
+		/// the time is kept per particle, so this is safe to call from
+		/// threaded updates & ages correctly with fixed timestep updates
 		void updateAge();
 
+		/// update the particles age by a given time diff in ms, ignores diffs
+		/// longer then the frame timeout, a lifespan of 0 lives until killed
+		void updateAge(double diff);
+
 		/// do the update calculations
 		virtual void update() = 0;
 
@@ -52,7 +60,7 @@ class ofxParticle : public ofRectangle {
 	/// \section Status
 
 		/// bring this particle to life
-		void reset() {bAlive = true; lifeTimer.set();}
+		void reset() {bAlive = true; ageStamp = ofxTimer::now();}
 
 		/// get the age in ms
 		double getAge() {return age;}
@@ -86,12 +94,14 @@ class ofxParticle : public ofRectangle {
 
 	protected:
 
+		friend class ofxParticleManager; // sets the age from a single frame sample
+
 		bool bAlive;        //< is this particle alive?
 
 		double lifespan;    //< how long this particle should live in ms
 		double age;         //< how old the particle is
-
-		ofxTimer lifeTimer; //< used to time the age between frames
+		uint64_t ageStamp;  //< clock time of the last age update in ns
+		bool bAutoAged;     //< aged by an ofxParticleManager? updateAge() does nothing if so
 
 	private:
 
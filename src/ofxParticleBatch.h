@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include "ofxParticle.h"
+#include "ofGraphics.h"
+#include "ofVboMesh.h"
+
+///	\class  ofxParticleBatch
+///	\brief  draws many particle rectangles as a single quad mesh
+///
+/// building the mesh is done on the CPU and does not require a GL context,
+/// so begin()/addQuad()/end() can be used headless, only draw() needs GL
+///
+/// usage:
+///
+///     batch.build(manager.getParticles());
+///     batch.draw();
+///
+/// note: all quads are drawn with the current color, per-particle draw()
+///       functions are not called
+class ofxParticleBatch {
+	public:
+
+		ofxParticleBatch() : numQuads(0), numIndexedQuads(0) {
+			mesh.setMode(OF_PRIMITIVE_TRIANGLES);
+			mesh.setUsage(GL_STREAM_DRAW);
+		}
+		virtual ~ofxParticleBatch() {}
+
+	/// \section Build
+
+		/// start a new batch, quads are interpreted using the given rect mode
+		void begin(ofRectMode mode=OF_RECTMODE_CORNER) {
+			rectMode = mode;
+			numQuads = 0;
+		}
+
+		/// add a quad to the current batch
+		void addQuad(float x, float y, float w, float h) {
+			std::vector<ofDefaultVertexType> &verts = mesh.getVertices();
+			unsigned int v = numQuads * 4;
+			if(verts.size() < v + 4) {
+				verts.resize(v + 4);
+			}
+			if(rectMode == OF_RECTMODE_CENTER) {
+				x -= w * 0.5f;
+				y -= h * 0.5f;
+			}
+			verts[v]   = ofDefaultVertexType(x, y, 0);
+			verts[v+1] = ofDefaultVertexType(x + w, y, 0);
+			verts[v+2] = ofDefaultVertexType(x + w, y + h, 0);
+			verts[v+3] = ofDefaultVertexType(x, y + h, 0);
+			numQuads++;
+		}
+
+		/// finish the current batch, trims the mesh to the number of quads added
+		void end() {
+			mesh.getVertices().resize(numQuads * 4);
+
+			// indices only change when the quad count changes
+			if(numQuads != numIndexedQuads) {
+				std::vector<ofIndexType> &indices = mesh.getIndices();
+				indices.resize(numQuads * 6);
+				for(unsigned int i = numIndexedQuads; i < numQuads; ++i) {
+					ofIndexType v = i * 4;
+					unsigned int n = i * 6;
+					indices[n]   = v;
+					indices[n+1] = v + 1;
+					indices[n+2] = v + 2;
+					indices[n+3] = v;
+					indices[n+4] = v + 2;
+					indices[n+5] = v + 3;
+				}
+				numIndexedQuads = numQuads;
+			}
+		}
+
+		/// build the batch from a list of particles using the current rect mode,
+		/// NULL particles are skipped
+		void build(const std::vector<ofxParticle*> &particles) {
+			build(particles, ofGetRectMode());
+		}
+		void build(const std::vector<ofxParticle*> &particles, ofRectMode mode) {
+			begin(mode);
+			for(unsigned int i = 0; i < particles.size(); ++i) {
+				const ofxParticle *p = particles[i];
+				if(p != NULL) {
+					addQuad(p->x, p->y, p->width, p->height);
+				}
+			}
+			end();
+		}
+
+	/// \section Draw
+
+		/// draw the batch in a single call
+		void draw() {
+			if(numQuads > 0) {
+				mesh.draw();
+			}
+		}
+
+	/// \section Util
+
+		/// get the number of quads in the current batch
+		unsigned int size() {return numQuads;}
+
+		/// get the built mesh
+		ofMesh& getMesh() {return mesh;}
+
+	protected:
+
+		ofVboMesh mesh; //< quad mesh
+		ofRectMode rectMode; //< how quad positions are interpreted
+		unsigned int numQuads; //< number of quads in the current batch
+		unsigned int numIndexedQuads; //< number of quads the indices are built for
+};
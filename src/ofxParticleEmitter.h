@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "ofxParticlePool.h"
+#include "ofMath.h"
+
+///	\class  ofxParticleEmitter
+///	\brief  spawns particles into an ofxParticlePool at a rate and/or in bursts
+///
+/// particles are spawned into the pool's pre-allocated slots, dead particle
+/// slots are reused by later spawns so emitting never allocates: an auto
+/// removing pool frees them in update(), otherwise the emitter recycles dead
+/// slots in place once the pool is full
+///
+/// new particles get a random position within the emit area and random size,
+/// lifespan, and velocity within the given ranges
+///
+/// usage:
+///
+///     ofxParticlePool pool(10000);
+///     ofxParticleEmitter emitter;
+///     emitter.setArea(ofRectangle(100, 100, 0, 0)); // a point
+///     emitter.setRate(500); // particles per second
+///
+///     // in update()
+///     emitter.update(pool);
+///     pool.update();
+///
+///     // on a beat
+///     emitter.burst(pool, 1000);
+///
+class ofxParticleEmitter {
+	public:
+
+		ofxParticleEmitter() : rate(0), remainder(0),
+			sizeMin(10), sizeMax(10), lifespanMin(1000), lifespanMax(1000),
+			velocityMin(0, 0), velocityMax(0, 0), recycleIndex(0) {}
+		virtual ~ofxParticleEmitter() {}
+
+	/// \section Emit
+
+		/// emit particles at the current rate using the time since the last update,
+		/// ignores time between frames longer than the ofxParticle frame timeout
+		/// returns the number of particles spawned
+		unsigned int update(ofxParticlePool &pool) {
+			double diff = timer.getDiffNanos() / 1000000.0;
+			timer.set();
+			if(diff >= ofxParticle::getFrameTimeout()) {
+				return 0;
+			}
+			return update(pool, diff);
+		}
+
+		/// emit particles at the current rate for a time diff in ms,
+		/// returns the number of particles spawned
+		unsigned int update(ofxParticlePool &pool, double diff) {
+			remainder += rate * diff / 1000.0;
+			unsigned int num = (unsigned int) remainder;
+			remainder -= num;
+			return burst(pool, num);
+		}
+
+		/// spawn a number of particles at once, stops when the pool is full of
+		/// living particles, returns the number of particles spawned
+		unsigned int burst(ofxParticlePool &pool, unsigned int num) {
+			unsigned int spawned = 0;
+			unsigned int scanned = 0; // dead slots searched in this burst
+			for(; spawned < num; ++spawned) {
+				int index = -1;
+				if(!pool.full()) {
+					index = pool.addParticle(0, 0, 0, 0);
+				}
+				else if(!pool.getAutoRemove()) {
+					index = _findDeadSlot(pool, scanned);
+				}
+				if(index < 0) {
+					break;
+				}
+				float size = ofRandom(sizeMin, sizeMax);
+				pool.resetParticle(index,
+					ofRandom(area.getLeft(), area.getRight()),
+					ofRandom(area.getTop(), area.getBottom()),
+					size, size, ofRandom(lifespanMin, lifespanMax));
+				pool.setVelocity(index,
+					ofRandom(velocityMin.x, velocityMax.x),
+					ofRandom(velocityMin.y, velocityMax.y));
+			}
+			return spawned;
+		}
+
+	/// \section Settings
+
+		/// get/set the emit rate in particles per second, 0 only emits bursts
+		void setRate(float rate) {this->rate = rate;}
+		float getRate() {return rate;}
+
+		/// get/set the area to spawn particles in, use a 0 size rect for a point
+		void setArea(const ofRectangle &area) {this->area = area;}
+		ofRectangle& getArea() {return area;}
+
+		/// get/set the particle size range
+		void setSize(float min, float max) {
+			sizeMin = min;
+			sizeMax = max;
+		}
+		float getSizeMin() {return sizeMin;}
+		float getSizeMax() {return sizeMax;}
+
+		/// get/set the particle lifespan range in ms, 0 lives until killed
+		void setLifespan(float min, float max) {
+			lifespanMin = min;
+			lifespanMax = max;
+		}
+		float getLifespanMin() {return lifespanMin;}
+		float getLifespanMax() {return lifespanMax;}
+
+		/// get/set the particle velocity range
+		void setVelocity(const ofVec2f &min, const ofVec2f &max) {
+			velocityMin = min;
+			velocityMax = max;
+		}
+		ofVec2f& getVelocityMin() {return velocityMin;}
+		ofVec2f& getVelocityMax() {return velocityMax;}
+
+	protected:
+
+		/// find a dead slot to recycle in a full pool, continuing from the last
+		/// one found, searches each slot at most once per burst,
+		/// returns -1 if there are none
+		int _findDeadSlot(ofxParticlePool &pool, unsigned int &scanned) {
+			unsigned int num = pool.size();
+			while(scanned < num) {
+				if(recycleIndex >= num) {
+					recycleIndex = 0;
+				}
+				unsigned int index = recycleIndex++;
+				scanned++;
+				if(!pool.isAlive(index)) {
+					return index;
+				}
+			}
+			return -1;
+		}
+
+		float rate; //< particles per second
+		double remainder; //< fractional particles left over from the last update
+
+		ofRectangle area; //< spawn area
+		float sizeMin, sizeMax; //< size range
+		float lifespanMin, lifespanMax; //< lifespan range in ms
+		ofVec2f velocityMin, velocityMax; //< velocity range
+
+		ofxTimer timer; //< used to time the emit rate between updates
+		unsigned int recycleIndex; //< next slot to search for a dead particle
+};
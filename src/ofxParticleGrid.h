@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "ofxParticle.h"
+
+///	\class  ofxParticleGrid
+///	\brief  a spatial hash for particle neighbor queries
+///
+/// particle positions are hashed into uniform grid cells, so radius and
+/// rectangle queries only look at nearby particles instead of all of them
+///
+/// queries return indices into the particle list or arrays given to build(),
+/// which are only valid until the particles change
+///
+/// note: particles are indexed by position (ofRectangle x & y), the width &
+///       height are not taken into account, so a query can miss a large
+///       particle whose bounds overlap the query area but whose position
+///       doesn't, grow the query by the largest particle size to include them
+///
+/// note: the index is fully rebuilt by build() with a counting sort, which
+///       is O(n) & does not allocate once sized, there are no incremental
+///       updates as moving particles change cells every frame anyway
+class ofxParticleGrid {
+	public:
+
+		ofxParticleGrid(float cellSize=50) : numEntries(0), mask(0), queryStamp(0) {
+			setCellSize(cellSize);
+		}
+		virtual ~ofxParticleGrid() {}
+
+	/// \section Build
+
+		/// rebuild the index from position arrays
+		void build(const float *xs, const float *ys, unsigned int num) {
+			_resize(num);
+
+			// count particles per cell
+			std::fill(cellStarts.begin(), cellStarts.end(), 0);
+			for(unsigned int i = 0; i < num; ++i) {
+				unsigned int cell = _hash(_cell(xs[i]), _cell(ys[i]));
+				cells[i] = cell;
+				cellStarts[cell+1]++;
+			}
+
+			// prefix sum to cell start offsets
+			for(unsigned int i = 1; i < cellStarts.size(); ++i) {
+				cellStarts[i] += cellStarts[i-1];
+			}
+
+			// place entries, cellEnds is used as the fill position
+			cellEnds.assign(cellStarts.begin(), cellStarts.end() - 1);
+			for(unsigned int i = 0; i < num; ++i) {
+				unsigned int n = cellEnds[cells[i]]++;
+				entries[n] = i;
+				entryXs[n] = xs[i];
+				entryYs[n] = ys[i];
+			}
+		}
+
+		/// rebuild the index from a list of particles, NULL particles are placed
+		/// far out of range
+		void build(const std::vector<ofxParticle*> &particles) {
+			xs.resize(particles.size());
+			ys.resize(particles.size());
+			for(unsigned int i = 0; i < particles.size(); ++i) {
+				if(particles[i] != NULL) {
+					xs[i] = particles[i]->x;
+					ys[i] = particles[i]->y;
+				}
+				else { // far away from everything
+					xs[i] = ys[i] = std::numeric_limits<float>::max();
+				}
+			}
+			build(xs.data(), ys.data(), particles.size());
+		}
+
+		/// clear the index
+		void clear() {
+			numEntries = 0;
+			std::fill(cellStarts.begin(), cellStarts.end(), 0);
+		}
+
+	/// \section Queries
+
+		/// find the indices of all particles within a radius of a point,
+		/// results are appended
+		void queryRadius(float x, float y, float radius, std::vector<unsigned int> &results) {
+			float radiusSq = radius * radius;
+			_query(x - radius, y - radius, x + radius, y + radius,
+			       [&](unsigned int n) {
+				float dx = entryXs[n] - x;
+				float dy = entryYs[n] - y;
+				if(dx*dx + dy*dy <= radiusSq) {
+					results.push_back(entries[n]);
+				}
+			});
+		}
+
+		/// find the indices of all particles inside a rectangle,
+		/// results are appended
+		void queryRect(const ofRectangle &rect, std::vector<unsigned int> &results) {
+			float left = std::min(rect.x, rect.x + rect.width);
+			float right = std::max(rect.x, rect.x + rect.width);
+			float top = std::min(rect.y, rect.y + rect.height);
+			float bottom = std::max(rect.y, rect.y + rect.height);
+			_query(left, top, right, bottom, [&](unsigned int n) {
+				if(entryXs[n] >= left && entryXs[n] <= right &&
+				   entryYs[n] >= top && entryYs[n] <= bottom) {
+					results.push_back(entries[n]);
+				}
+			});
+		}
+
+	/// \section Util
+
+		/// get/set the grid cell size, should be around the typical query radius
+		/// note: call build() after changing
+		float getCellSize() {return cellSize;}
+		void setCellSize(float size) {
+			cellSize = (size > 0) ? size : 1;
+		}
+
+		/// get the number of indexed particles
+		unsigned int size() {return numEntries;}
+
+	protected:
+
+		/// visit all entries in the cells overlapping a bounding box,
+		/// each hash bucket is visited only once
+		template <class Visitor>
+		void _query(float left, float top, float right, float bottom, Visitor visit) {
+			if(numEntries == 0) {
+				return;
+			}
+			int minX = _cell(left), maxX = _cell(right);
+			int minY = _cell(top), maxY = _cell(bottom);
+
+			// scan everything if the box covers more cells than buckets
+			if((double)(maxX - minX + 1) * (double)(maxY - minY + 1) >= (double)bucketStamps.size()) {
+				for(unsigned int n = 0; n < numEntries; ++n) {
+					visit(n);
+				}
+				return;
+			}
+
+			// mark visited buckets, different cells can share a bucket
+			queryStamp++;
+			if(queryStamp == 0) {
+				std::fill(bucketStamps.begin(), bucketStamps.end(), 0);
+				queryStamp = 1;
+			}
+			for(int cy = minY; cy <= maxY; ++cy) {
+				for(int cx = minX; cx <= maxX; ++cx) {
+					unsigned int bucket = _hash(cx, cy);
+					if(bucketStamps[bucket] == queryStamp) {
+						continue;
+					}
+					bucketStamps[bucket] = queryStamp;
+					for(unsigned int n = cellStarts[bucket]; n < cellStarts[bucket+1]; ++n) {
+						visit(n);
+					}
+				}
+			}
+		}
+
+		/// grow the buffers for a number of entries, never shrinks
+		void _resize(unsigned int num) {
+			numEntries = num;
+			if(entries.size() < num) {
+				entries.resize(num);
+				entryXs.resize(num);
+				entryYs.resize(num);
+				cells.resize(num);
+			}
+
+			// keep around 2 buckets per entry, power of 2 for masking
+			unsigned int buckets = 64;
+			while(buckets < num * 2) {
+				buckets <<= 1;
+			}
+			if(buckets > bucketStamps.size()) {
+				bucketStamps.assign(buckets, 0);
+				cellStarts.resize(buckets + 1);
+				mask = buckets - 1;
+				queryStamp = 0;
+			}
+		}
+
+		/// get the cell coordinate for a position, clamped to avoid overflow
+		inline int _cell(float pos) {
+			double cell = std::floor((double)pos / cellSize);
+			return (int)std::max(-1073741824.0, std::min(cell, 1073741824.0));
+		}
+
+		/// hash a cell coordinate to a bucket
+		inline unsigned int _hash(int cx, int cy) {
+			return (((unsigned int)cx * 73856093u) ^ ((unsigned int)cy * 19349663u)) & mask;
+		}
+
+		float cellSize; //< grid cell size
+		unsigned int numEntries; //< number of indexed particles
+		unsigned int mask; //< bucket index mask
+
+		std::vector<unsigned int> cellStarts; //< entry offset per bucket, size buckets+1
+		std::vector<unsigned int> cellEnds;   //< fill positions while building
+		std::vector<unsigned int> cells;      //< bucket per particle while building
+		std::vector<unsigned int> entries;    //< particle indices sorted by bucket
+		std::vector<float> entryXs; //< x positions sorted by bucket
+		std::vector<float> entryYs; //< y positions sorted by bucket
+
+		std::vector<unsigned int> bucketStamps; //< last query that visited each bucket
+		unsigned int queryStamp; //< current query id
+
+		std::vector<float> xs; //< particle x positions when building from particles
+		std::vector<float> ys; //< particle y positions when building from particles
+};
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <cmath>
+
+#include "ofRectangle.h"
+#include "ofGraphics.h"
+
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define OFX_PARTICLE_INTEGRATOR_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define OFX_PARTICLE_INTEGRATOR_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define OFX_PARTICLE_INTEGRATOR_NEON
+#endif
+
+///	\class  ofxParticleIntegrator
+///	\brief  a vectorized kinematic integration kernel for particle arrays
+///
+/// for each particle:
+///
+///     vel += acc * dt
+///     vel *= damping
+///     pos += vel * dt
+///
+/// and optionally reflects particles off of the bounds edges
+///
+/// uses AVX, SSE2, or NEON when available with a scalar fallback,
+/// the arrays do not need to be aligned
+///
+/// to bounce off of the app render area:
+///
+///     integrator.setBounds(ofRectangle(0, 0, app->getRenderWidth(), app->getRenderHeight()));
+///
+class ofxParticleIntegrator {
+	public:
+
+		ofxParticleIntegrator() :
+			damping(1.0), bBounce(false), rectMode(OF_RECTMODE_CORNER) {}
+		virtual ~ofxParticleIntegrator() {}
+
+	/// \section Integrate
+
+		/// integrate num particles by a time step, dt is in the same units as
+		/// the velocities (ie. 1 for per frame velocities)
+		///
+		/// accelerations & sizes can be NULL, sizes are only used when bouncing
+		void integrate(float *xs, float *ys, float *vxs, float *vys,
+		               const float *axs, const float *ays,
+		               const float *widths, const float *heights,
+		               unsigned int num, float dt=1) const {
+			float anchor = (rectMode == OF_RECTMODE_CENTER) ? 0.5f : 0.0f;
+			_integrate(xs, vxs, axs, widths, num, dt, anchor,
+			           bounds.getLeft(), bounds.getRight());
+			_integrate(ys, vys, ays, heights, num, dt, anchor,
+			           bounds.getTop(), bounds.getBottom());
+		}
+
+	/// \section Settings
+
+		/// get/set the velocity damping factor per step, 1 is no damping (default)
+		void setDamping(float damping) {this->damping = damping;}
+		float getDamping() {return damping;}
+
+		/// get/set the bounds rectangle to bounce off of, enables bouncing
+		void setBounds(const ofRectangle &bounds) {
+			this->bounds = bounds;
+			bBounce = true;
+		}
+		ofRectangle& getBounds() {return bounds;}
+
+		/// enable/disable bouncing off of the bounds edges (off by default)
+		void setBounce(bool bounce) {bBounce = bounce;}
+		bool getBounce() {return bBounce;}
+
+		/// get/set how the particle positions are interpreted when bouncing,
+		/// OF_RECTMODE_CORNER (default) or OF_RECTMODE_CENTER
+		void setRectMode(ofRectMode mode) {rectMode = mode;}
+		ofRectMode getRectMode() {return rectMode;}
+
+	protected:
+
+		/// integrate a single axis
+		void _integrate(float *pos, float *vel, const float *acc, const float *size,
+		                unsigned int num, float dt, float anchor, float min, float max) const {
+			unsigned int i = 0;
+			bool bounce = bBounce && size != NULL;
+
+		#if defined(OFX_PARTICLE_INTEGRATOR_AVX)
+			const __m256 vdt = _mm256_set1_ps(dt);
+			const __m256 vdamping = _mm256_set1_ps(damping);
+			const __m256 vmin = _mm256_set1_ps(min);
+			const __m256 vmax = _mm256_set1_ps(max);
+			const __m256 vlo = _mm256_set1_ps(anchor);
+			const __m256 vhi = _mm256_set1_ps(1.0f - anchor);
+			const __m256 vsign = _mm256_set1_ps(-0.0f);
+			for(; i + 8 <= num; i += 8) {
+				__m256 p = _mm256_loadu_ps(pos + i);
+				__m256 v = _mm256_loadu_ps(vel + i);
+				if(acc != NULL) {
+					v = _mm256_add_ps(v, _mm256_mul_ps(_mm256_loadu_ps(acc + i), vdt));
+				}
+				v = _mm256_mul_ps(v, vdamping);
+				p = _mm256_add_ps(p, _mm256_mul_ps(v, vdt));
+				if(bounce) {
+					__m256 s = _mm256_loadu_ps(size + i);
+					__m256 lo = _mm256_add_ps(vmin, _mm256_mul_ps(s, vlo));
+					__m256 hi = _mm256_sub_ps(vmax, _mm256_mul_ps(s, vhi));
+					__m256 below = _mm256_cmp_ps(p, lo, _CMP_LT_OQ);
+					__m256 above = _mm256_andnot_ps(below, _mm256_cmp_ps(p, hi, _CMP_GT_OQ));
+					__m256 speed = _mm256_andnot_ps(vsign, v);
+					v = _mm256_blendv_ps(v, speed, below);
+					v = _mm256_blendv_ps(v, _mm256_or_ps(speed, vsign), above);
+					p = _mm256_blendv_ps(p, lo, below);
+					p = _mm256_blendv_ps(p, hi, above);
+				}
+				_mm256_storeu_ps(pos + i, p);
+				_mm256_storeu_ps(vel + i, v);
+			}
+		#elif defined(OFX_PARTICLE_INTEGRATOR_SSE)
+			const __m128 vdt = _mm_set1_ps(dt);
+			const __m128 vdamping = _mm_set1_ps(damping);
+			const __m128 vmin = _mm_set1_ps(min);
+			const __m128 vmax = _mm_set1_ps(max);
+			const __m128 vlo = _mm_set1_ps(anchor);
+			const __m128 vhi = _mm_set1_ps(1.0f - anchor);
+			const __m128 vsign = _mm_set1_ps(-0.0f);
+			for(; i + 4 <= num; i += 4) {
+				__m128 p = _mm_loadu_ps(pos + i);
+				__m128 v = _mm_loadu_ps(vel + i);
+				if(acc != NULL) {
+					v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(acc + i), vdt));
+				}
+				v = _mm_mul_ps(v, vdamping);
+				p = _mm_add_ps(p, _mm_mul_ps(v, vdt));
+				if(bounce) {
+					__m128 s = _mm_loadu_ps(size + i);
+					__m128 lo = _mm_add_ps(vmin, _mm_mul_ps(s, vlo));
+					__m128 hi = _mm_sub_ps(vmax, _mm_mul_ps(s, vhi));
+					__m128 below = _mm_cmplt_ps(p, lo);
+					__m128 above = _mm_andnot_ps(below, _mm_cmpgt_ps(p, hi));
+					__m128 speed = _mm_andnot_ps(vsign, v);
+					v = _mm_or_ps(_mm_and_ps(below, speed), _mm_andnot_ps(below, v));
+					v = _mm_or_ps(_mm_and_ps(above, _mm_or_ps(speed, vsign)), _mm_andnot_ps(above, v));
+					p = _mm_or_ps(_mm_and_ps(below, lo), _mm_andnot_ps(below, p));
+					p = _mm_or_ps(_mm_and_ps(above, hi), _mm_andnot_ps(above, p));
+				}
+				_mm_storeu_ps(pos + i, p);
+				_mm_storeu_ps(vel + i, v);
+			}
+		#elif defined(OFX_PARTICLE_INTEGRATOR_NEON)
+			const float32x4_t vdt = vdupq_n_f32(dt);
+			const float32x4_t vdamping = vdupq_n_f32(damping);
+			const float32x4_t vmin = vdupq_n_f32(min);
+			const float32x4_t vmax = vdupq_n_f32(max);
+			const float32x4_t vlo = vdupq_n_f32(anchor);
+			const float32x4_t vhi = vdupq_n_f32(1.0f - anchor);
+			for(; i + 4 <= num; i += 4) {
+				float32x4_t p = vld1q_f32(pos + i);
+				float32x4_t v = vld1q_f32(vel + i);
+				if(acc != NULL) {
+					v = vmlaq_f32(v, vld1q_f32(acc + i), vdt);
+				}
+				v = vmulq_f32(v, vdamping);
+				p = vmlaq_f32(p, v, vdt);
+				if(bounce) {
+					float32x4_t s = vld1q_f32(size + i);
+					float32x4_t lo = vmlaq_f32(vmin, s, vlo);
+					float32x4_t hi = vmlsq_f32(vmax, s, vhi);
+					uint32x4_t below = vcltq_f32(p, lo);
+					uint32x4_t above = vbicq_u32(vcgtq_f32(p, hi), below);
+					float32x4_t speed = vabsq_f32(v);
+					v = vbslq_f32(below, speed, v);
+					v = vbslq_f32(above, vnegq_f32(speed), v);
+					p = vbslq_f32(below, lo, p);
+					p = vbslq_f32(above, hi, p);
+				}
+				vst1q_f32(pos + i, p);
+				vst1q_f32(vel + i, v);
+			}
+		#endif
+
+			// scalar fallback & remainder, the vector paths match this exactly:
+			// below is checked first, so a particle larger than the bounds
+			// (lo > hi) is clamped to lo & moves forward
+			for(; i < num; ++i) {
+				float v = vel[i];
+				if(acc != NULL) {
+					v += acc[i] * dt;
+				}
+				v *= damping;
+				float p = pos[i] + v * dt;
+				if(bounce) {
+					float lo = min + size[i] * anchor;
+					float hi = max - size[i] * (1.0f - anchor);
+					if(p < lo) {
+						p = lo;
+						v = std::fabs(v);
+					}
+					else if(p > hi) {
+						p = hi;
+						v = -std::fabs(v);
+					}
+				}
+				pos[i] = p;
+				vel[i] = v;
+			}
+		}
+
+		float damping; //< velocity damping per step
+		ofRectangle bounds; //< bounds to bounce off of
+		bool bBounce; //< bounce off of the bounds edges?
+		ofRectMode rectMode; //< particle position mode when bouncing
+};
@@ -11,6 +11,10 @@
 #pragma once
 
 #include "ofxParticle.h"
+#include "ofxParticleBatch.h"
+#include "ofxThreadPool.h"
+#include "ofxParticleGrid.h"
+#include "ofxTrace.h"
 
 
 ///	\class  ofxParticleManager
@@ -18,7 +22,10 @@
 class ofxParticleManager {
 	public:
 
-		ofxParticleManager(bool autoRemove=true) : bAutoRemove(autoRemove) {}
+		ofxParticleManager(bool autoRemove=true) :
+			bAutoRemove(autoRemove), bPreserveOrder(false),
+			bThreadedUpdate(false), grainSize(256), threadPool(NULL),
+			bAutoAge(true), frameDiff(0), frameStamp(ofxTimer::now()), bSpatialIndex(false) {}
 		virtual ~ofxParticleManager() {
 			clear(); // cleanup
 		}
@@ -36,6 +43,9 @@ class ofxParticleManager {
 		}
 	
 		/// pop (remove) the first aka oldest particle
+		///
+		/// note: O(n) as all remaining particles are shifted down, kill the
+		///       particle instead to remove it in the next update()
 		void popFirstParticle() {
 			if(!particles.empty()) {
 				particles.erase(particles.begin());
@@ -63,6 +73,45 @@ class ofxParticleManager {
 		/// automatically remove (delete) dead particles?
 		inline bool getAutoRemove() {return bAutoRemove;}
 		void setAutoRemove(bool yesno) {bAutoRemove = yesno;}
+
+		/// preserve the particle order when removing dead particles? (off by default)
+		///
+		/// dead particles are normally removed by swapping in the last particle,
+		/// enable this if the draw order must be kept
+		inline bool getPreserveOrder() {return bPreserveOrder;}
+		void setPreserveOrder(bool yesno) {bPreserveOrder = yesno;}
+
+		/// automatically age particles in update()? (on by default)
+		///
+		/// the frame time is sampled once per update and used to age all
+		/// particles, ignoring frames longer than the ofxParticle frame timeout,
+		/// particle updateAge() calls do nothing while this is enabled
+		///
+		/// disable to age particles with their own per particle updateAge()
+		/// calls (legacy), which read the clock once per particle
+		inline bool getAutoAge() {return bAutoAge;}
+		void setAutoAge(bool yesno) {
+			bAutoAge = yesno;
+			frameStamp = ofxTimer::now();
+		}
+
+		/// update particles in parallel on a thread pool? (off by default)
+		///
+		/// the particle range is split into chunks of grainSize particles and
+		/// update() returns after all chunks are done, so it's safe to draw
+		/// afterwards
+		///
+		/// uses the shared ofxThreadPool if pool is NULL, the pool is never deleted
+		///
+		/// note: particle update() functions must be thread safe, dead particles
+		///       are still removed on the calling thread
+		void setThreadedUpdate(bool threaded, unsigned int grainSize=256, ofxThreadPool *pool=NULL) {
+			bThreadedUpdate = threaded;
+			this->grainSize = grainSize;
+			threadPool = pool;
+		}
+		inline bool getThreadedUpdate() {return bThreadedUpdate;}
+		inline unsigned int getGrainSize() {return grainSize;}
     
     /// \section Particle Access
     
@@ -95,35 +144,80 @@ class ofxParticleManager {
 	
 		/// get access to the particles vector
 		vector<ofxParticle*>& getParticles() {return particles;};
+
+	/// \section Neighbor Queries
+
+		/// enable/disable the spatial index used for neighbor queries (off by default),
+		/// the index is rebuilt at the end of each update()
+		///
+		/// set the cell size to around the typical query radius
+		void setSpatialIndex(bool index, float cellSize=50) {
+			bSpatialIndex = index;
+			grid.setCellSize(cellSize);
+			if(bSpatialIndex) {
+				grid.build(particles);
+			}
+			else {
+				grid.clear();
+			}
+		}
+		inline bool getSpatialIndex() {return bSpatialIndex;}
+
+		/// find all particles within a radius of a point, results are appended
+		///
+		/// note: uses the positions from the last update(), requires the spatial
+		///       index to be enabled, particle bounds are not taken into
+		///       account (see ofxParticleGrid)
+		void getParticlesNear(float x, float y, float radius, std::vector<ofxParticle*> &results) {
+			queryIndices.clear();
+			grid.queryRadius(x, y, radius, queryIndices);
+			_appendQueryResults(results);
+		}
+
+		/// find all particles inside a rectangle, results are appended
+		///
+		/// note: uses the positions from the last update(), requires the spatial
+		///       index to be enabled, particle bounds are not taken into
+		///       account (see ofxParticleGrid)
+		void getParticlesInside(const ofRectangle &rect, std::vector<ofxParticle*> &results) {
+			queryIndices.clear();
+			grid.queryRect(rect, queryIndices);
+			_appendQueryResults(results);
+		}
+
+		/// get access to the spatial index, query results are particle indices
+		ofxParticleGrid& getGrid() {return grid;}
 		
 	/// \section Update & Draw
 
-		/// update all particles
+		/// update all particles, dead particles are removed in a single pass
 		virtual void update() {
-			std::vector<ofxParticle*> ::iterator iter;
-			for(iter = particles.begin(); iter != particles.end();) {
-				// remove particle if it's NULL
-				if((*iter) == NULL) {
-					ofLogWarning("ofxParticleManager") << "update(): removing NULL particle";
-					iter = particles.erase(iter);
-				}
-				else {
-					// auto remove dead particles?
-					if(bAutoRemove && !(*iter)->isAlive()) {
-						delete (*iter);
-						iter = particles.erase(iter);
-					}
-					else {
-						(*iter)->update();
-						++iter; // increment iter
+			OFX_TRACE_SCOPE("ofxParticleManager::update");
+			if(bAutoAge) {
+				uint64_t now = ofxTimer::now();
+				frameDiff = (now > frameStamp) ? (now - frameStamp) / 1000000.0 : 0;
+				frameStamp = now;
+			}
+			if(bThreadedUpdate) {
+				_compact(false);
+				ofxThreadPool &pool = (threadPool ? *threadPool : ofxThreadPool::shared());
+				pool.parallelFor(particles.size(), grainSize, [this](unsigned int begin, unsigned int end) {
+					for(unsigned int i = begin; i < end; ++i) {
+						_updateParticle(particles[i]);
 					}
-				}
+				});
+			}
+			else {
+				_compact(true);
+			}
+			if(bSpatialIndex) {
+				grid.build(particles);
 			}
-
 		}
 
-		/// draw all the particles
+		/// draw all the particles using their draw() functions
 		virtual void draw() {
+			OFX_TRACE_SCOPE("ofxParticleManager::draw");
 			std::vector<ofxParticle*> ::iterator iter;
 			for(iter = particles.begin(); iter != particles.end();){
 				// remove particle if it's NULL
@@ -138,6 +232,14 @@ class ofxParticleManager {
 			}
 		}
 		
+		/// draw all the particle rectangles as a single batched mesh using the
+		/// current rect mode & color, particle draw() functions are not called
+		void drawBatched() {
+			OFX_TRACE_SCOPE("ofxParticleManager::drawBatched");
+			batch.build(particles);
+			batch.draw();
+		}
+
 	/// \section Util
 		
 		/// get the number of particles
@@ -152,6 +254,88 @@ class ofxParticleManager {
 
 	protected:
 
+		/// remove dead particles in a single pass, optionally updating the
+		/// remaining particles at the same time
+		void _compact(bool bUpdate) {
+			unsigned int num = particles.size();
+			if(bPreserveOrder) {
+				// shift living particles down over the removed ones
+				unsigned int last = 0;
+				for(unsigned int i = 0; i < num; ++i) {
+					if(_removeParticle(particles[i])) {
+						continue;
+					}
+					if(bUpdate) {
+						_updateParticle(particles[i]);
+					}
+					particles[last++] = particles[i];
+				}
+				num = last;
+			}
+			else {
+				// swap removed particles with the last one
+				unsigned int i = 0;
+				while(i < num) {
+					if(_removeParticle(particles[i])) {
+						particles[i] = particles[--num];
+					}
+					else {
+						if(bUpdate) {
+							_updateParticle(particles[i]);
+						}
+						++i;
+					}
+				}
+			}
+			particles.resize(num);
+		}
+
+		/// convert spatial index query results to particle pointers
+		void _appendQueryResults(std::vector<ofxParticle*> &results) {
+			for(unsigned int i = 0; i < queryIndices.size(); ++i) {
+				if(queryIndices[i] < particles.size()) {
+					results.push_back(particles[queryIndices[i]]);
+				}
+			}
+		}
+
+		/// age (if enabled) & update a particle, the particle's age stamp is
+		/// kept in sync so turning auto aging off continues from this frame
+		inline void _updateParticle(ofxParticle *particle) {
+			particle->bAutoAged = bAutoAge;
+			if(bAutoAge) {
+				particle->updateAge(frameDiff);
+				particle->ageStamp = frameStamp;
+			}
+			particle->update();
+		}
+
+		/// deletes the particle & returns true if it should be removed
+		bool _removeParticle(ofxParticle *particle) {
+			// remove particle if it's NULL
+			if(particle == NULL) {
+				ofLogWarning("ofxParticleManager") << "update(): removing NULL particle";
+				return true;
+			}
+			// auto remove dead particles?
+			if(bAutoRemove && !particle->isAlive()) {
+				delete particle;
+				return true;
+			}
+			return false;
+		}
+
 		bool bAutoRemove; //< automatically remove dead particles?
+		bool bPreserveOrder; //< keep particle order when removing?
+		bool bThreadedUpdate; //< update particles in parallel?
+		unsigned int grainSize; //< number of particles per parallel update chunk
+		ofxThreadPool *threadPool; //< thread pool to use, NULL for the shared pool
+		bool bAutoAge; //< age particles automatically?
+		double frameDiff; //< time since the last update in ms
+		uint64_t frameStamp; //< clock time of the last update in ns
+		bool bSpatialIndex; //< rebuild the spatial index on update?
+		ofxParticleGrid grid; //< spatial index for neighbor queries
+		std::vector<unsigned int> queryIndices; //< spatial index query results
 		std::vector<ofxParticle*> particles; //< current particles
+		ofxParticleBatch batch; //< batched mesh for drawBatched()
 };
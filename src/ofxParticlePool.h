@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include "ofxParticle.h"
+#include "ofxParticleBatch.h"
+#include "ofxParticleIntegrator.h"
+#include "ofGraphics.h"
+#include "ofLog.h"
+
+///	\class  ofxParticlePool
+///	\brief  a fixed capacity particle container using structure-of-arrays storage
+///
+/// particle data is kept in contiguous arrays (x, y, w, h, vel, acc, age,
+/// lifespan, alive)
+/// instead of one heap allocated ofxParticle per particle, so adding and
+/// removing particles does not allocate once the pool is created
+///
+/// inherit this and override update() and/or draw() to add behavior, call
+/// ofxParticlePool::update() to handle aging and dead particle removal
+///
+/// note: particle indices are not stable, they change when dead particles are
+///       removed
+class ofxParticlePool {
+	public:
+
+		/// capacity is the max number of particles
+		ofxParticlePool(unsigned int capacity=1000, bool autoRemove=true) :
+			bAutoRemove(autoRemove), bPreserveOrder(false), numParticles(0) {
+			setCapacity(capacity);
+		}
+		virtual ~ofxParticlePool() {}
+
+	/// \section Particle Control
+
+		/// add a particle with a lifespan in ms, a lifespan of 0 lives until killed
+		/// returns the particle index or -1 if the pool is full
+		int addParticle(float x, float y, float w, float h, double lifespan=0) {
+			if(numParticles >= capacity) {
+				ofLogWarning("ofxParticlePool") << "cannot add particle, pool is full";
+				return -1;
+			}
+			unsigned int i = numParticles++;
+			resetParticle(i, x, y, w, h, lifespan);
+			return i;
+		}
+
+		/// add a particle using an ofRectangle for the position & size
+		int addParticle(const ofRectangle &rect, double lifespan=0) {
+			return addParticle(rect.x, rect.y, rect.width, rect.height, lifespan);
+		}
+
+		/// reset an existing particle slot as a new living particle with a
+		/// lifespan in ms, ie. to recycle a dead particle in a pool which does
+		/// not auto remove
+		void resetParticle(unsigned int index, float x, float y, float w, float h, double lifespan=0) {
+			xs[index] = x;
+			ys[index] = y;
+			widths[index] = w;
+			heights[index] = h;
+			vxs[index] = vys[index] = 0;
+			axs[index] = ays[index] = 0;
+			ages[index] = 0;
+			lifespans[index] = lifespan;
+			alive[index] = 1;
+		}
+
+		/// pop (remove) the first aka oldest particle
+		void popFirstParticle() {
+			if(numParticles > 0) {
+				removeParticle(0);
+			}
+		}
+
+		/// pop (remove) the last aka newest particle
+		void popLastParticle() {
+			if(numParticles > 0) {
+				numParticles--;
+			}
+		}
+
+		/// remove a particle by index, shifts all following particles down
+		void removeParticle(unsigned int index) {
+			if(index >= numParticles) {
+				return;
+			}
+			for(unsigned int i = index + 1; i < numParticles; ++i) {
+				moveParticle(i, i-1);
+			}
+			numParticles--;
+		}
+
+		/// clear (remove) all particles
+		void clear() {
+			numParticles = 0;
+		}
+
+		/// get/set the max number of particles,
+		/// particles past the new capacity are removed when shrinking
+		unsigned int getCapacity() {return capacity;}
+		void setCapacity(unsigned int capacity) {
+			this->capacity = capacity;
+			xs.resize(capacity);
+			ys.resize(capacity);
+			widths.resize(capacity);
+			heights.resize(capacity);
+			vxs.resize(capacity);
+			vys.resize(capacity);
+			axs.resize(capacity);
+			ays.resize(capacity);
+			ages.resize(capacity);
+			lifespans.resize(capacity);
+			alive.resize(capacity);
+			if(numParticles > capacity) {
+				numParticles = capacity;
+			}
+		}
+
+		/// automatically remove dead particles?
+		inline bool getAutoRemove() {return bAutoRemove;}
+		void setAutoRemove(bool yesno) {bAutoRemove = yesno;}
+
+		/// preserve the particle order when removing dead particles? (off by default)
+		///
+		/// dead particles are normally removed by moving the last particle into
+		/// their place, enable this if the draw order must be kept
+		inline bool getPreserveOrder() {return bPreserveOrder;}
+		void setPreserveOrder(bool yesno) {bPreserveOrder = yesno;}
+
+	/// \section Particle Access
+
+		/// get/set a particle's position & size, index is not bounds checked
+		inline float getX(unsigned int index)      {return xs[index];}
+		inline float getY(unsigned int index)      {return ys[index];}
+		inline float getWidth(unsigned int index)  {return widths[index];}
+		inline float getHeight(unsigned int index) {return heights[index];}
+		ofRectangle getRectangle(unsigned int index) {
+			return ofRectangle(xs[index], ys[index], widths[index], heights[index]);
+		}
+		inline void setPosition(unsigned int index, float x, float y) {
+			xs[index] = x;
+			ys[index] = y;
+		}
+		inline void setSize(unsigned int index, float w, float h) {
+			widths[index] = w;
+			heights[index] = h;
+		}
+
+		/// get/set a particle's velocity & acceleration, index is not bounds checked
+		inline float getVelocityX(unsigned int index)     {return vxs[index];}
+		inline float getVelocityY(unsigned int index)     {return vys[index];}
+		inline float getAccelerationX(unsigned int index) {return axs[index];}
+		inline float getAccelerationY(unsigned int index) {return ays[index];}
+		inline void setVelocity(unsigned int index, float vx, float vy) {
+			vxs[index] = vx;
+			vys[index] = vy;
+		}
+		inline void setAcceleration(unsigned int index, float ax, float ay) {
+			axs[index] = ax;
+			ays[index] = ay;
+		}
+
+		/// get a particle's age in ms
+		inline double getAge(unsigned int index) {return ages[index];}
+
+		/// get a particle's age normalized between 0 and 1: 0 is birth, 1 is death
+		double getAgeN(unsigned int index) {
+			if(lifespans[index] == 0) {
+				return 0;
+			}
+			return ages[index]/lifespans[index];
+		}
+
+		/// get/set a particle's lifespan in ms
+		inline double getLifespan(unsigned int index) {return lifespans[index];}
+		inline void setLifespan(unsigned int index, double span) {lifespans[index] = span;}
+
+		/// is a particle alive?
+		inline bool isAlive(unsigned int index) {return alive[index] != 0;}
+
+		/// kill a particle
+		inline void kill(unsigned int index) {alive[index] = 0; ages[index] = 0;}
+
+		/// direct access to the particle arrays, only the first size() entries
+		/// are valid
+		float* getXs()          {return xs.data();}
+		float* getYs()          {return ys.data();}
+		float* getWidths()      {return widths.data();}
+		float* getHeights()     {return heights.data();}
+		float* getVelocityXs()  {return vxs.data();}
+		float* getVelocityYs()  {return vys.data();}
+		float* getAccelerationXs() {return axs.data();}
+		float* getAccelerationYs() {return ays.data();}
+		double* getAges()       {return ages.data();}
+		double* getLifespans()  {return lifespans.data();}
+		unsigned char* getAlive() {return alive.data();}
+
+	/// \section Update & Draw
+
+		/// age all particles using a single frame time sample & remove dead
+		/// particles, ignores time between frames longer than the
+		/// ofxParticle frame timeout
+		virtual void update() {
+
+			// ignore if time from last frame was too long
+			double diff = frameTimer.getDiffNanos() / 1000000.0;
+			frameTimer.set();
+			if(diff < ofxParticle::getFrameTimeout()) {
+				for(unsigned int i = 0; i < numParticles; ++i) {
+					if(!alive[i]) {
+						continue;
+					}
+					ages[i] += diff;
+					if(lifespans[i] > 0 && ages[i] >= lifespans[i]) {
+						kill(i);
+					}
+				}
+			}
+
+			// auto remove dead particles? compact in a single pass
+			if(bAutoRemove) {
+				if(bPreserveOrder) {
+					unsigned int last = 0;
+					for(unsigned int i = 0; i < numParticles; ++i) {
+						if(alive[i]) {
+							if(i != last) {
+								moveParticle(i, last);
+							}
+							last++;
+						}
+					}
+					numParticles = last;
+				}
+				else {
+					unsigned int i = 0;
+					while(i < numParticles) {
+						if(!alive[i]) {
+							numParticles--;
+							if(i != numParticles) {
+								moveParticle(numParticles, i);
+							}
+						}
+						else {
+							++i;
+						}
+					}
+				}
+			}
+		}
+
+		/// move all particles by their velocities & accelerations using the
+		/// given integrator, dt is in the same units as the velocities
+		void integrate(const ofxParticleIntegrator &integrator, float dt=1) {
+			integrator.integrate(xs.data(), ys.data(), vxs.data(), vys.data(),
+			                     axs.data(), ays.data(), widths.data(), heights.data(),
+			                     numParticles, dt);
+		}
+
+		/// draw all the particles as rectangles in a single batched mesh using
+		/// the current rect mode & color
+		virtual void draw() {
+			batch.begin(ofGetRectMode());
+			for(unsigned int i = 0; i < numParticles; ++i) {
+				batch.addQuad(xs[i], ys[i], widths[i], heights[i]);
+			}
+			batch.end();
+			batch.draw();
+		}
+
+	/// \section Util
+
+		/// get the number of particles
+		unsigned int size() {
+			return numParticles;
+		}
+
+		/// are there any particles at all?
+		bool empty() {
+			return numParticles == 0;
+		}
+
+		/// is the pool at capacity?
+		bool full() {
+			return numParticles >= capacity;
+		}
+
+	protected:
+
+		/// copy particle data from one index to another,
+		/// override to move any additional per-particle arrays
+		virtual void moveParticle(unsigned int from, unsigned int to) {
+			xs[to] = xs[from];
+			ys[to] = ys[from];
+			widths[to] = widths[from];
+			heights[to] = heights[from];
+			vxs[to] = vxs[from];
+			vys[to] = vys[from];
+			axs[to] = axs[from];
+			ays[to] = ays[from];
+			ages[to] = ages[from];
+			lifespans[to] = lifespans[from];
+			alive[to] = alive[from];
+		}
+
+		bool bAutoRemove; //< automatically remove dead particles?
+		bool bPreserveOrder; //< keep particle order when removing?
+		unsigned int capacity; //< max number of particles
+		unsigned int numParticles; //< current number of particles
+
+		std::vector<float> xs;  //< x positions
+		std::vector<float> ys;  //< y positions
+		std::vector<float> widths;  //< widths
+		std::vector<float> heights; //< heights
+		std::vector<float> vxs; //< x velocities
+		std::vector<float> vys; //< y velocities
+		std::vector<float> axs; //< x accelerations
+		std::vector<float> ays; //< y accelerations
+		std::vector<double> ages;   //< ages in ms
+		std::vector<double> lifespans; //< lifespans in ms, 0 lives until killed
+		std::vector<unsigned char> alive; //< alive flags
+
+		ofxTimer frameTimer; //< used to time the age between frames
+		ofxParticleBatch batch; //< batched mesh for drawing
+};
@@ -11,16 +11,21 @@
 #include "ofxScene.h"
 
 #include "ofAppRunner.h"
+#include "ofLog.h"
 
 /// RUNNER SCENE
 
 //--------------------------------------------------------------
 ofxScene::RunnerScene::RunnerScene(ofxScene *scene) {
 	this->scene = scene;
+	bProfile = false;
 }
 
 //--------------------------------------------------------------
 ofxScene::RunnerScene::~RunnerScene() {
+	if(_loader.valid()) {
+		_loader.wait();
+	}
 	if(scene != NULL) {
 		delete scene;
 	}
@@ -29,8 +34,17 @@ ofxScene::RunnerScene::~RunnerScene() {
 //--------------------------------------------------------------
 void ofxScene::RunnerScene::setup() {
 	if(!scene->_bSetup) {
+		uint64_t start = _profileStart();
+		if(_loader.valid()) {
+			_finishLoading(); // blocks if still loading
+		}
+		else if(!scene->_bLoaded) {
+			scene->setupAsync();
+			scene->_bLoaded = true;
+		}
 		scene->setup();
 		scene->_bSetup = true;
+		_profileEnd(ofxSceneProfile::SETUP, start);
 	}
 }
 
@@ -44,16 +58,20 @@ void ofxScene::RunnerScene::update() {
     scene->mouseX = ofGetMouseX();
     scene->mouseY = ofGetMouseY();
 
+	uint64_t start = _profileStart();
 	if(scene->_bEntering) {
 		scene->updateEnter();
 		scene->_bEnteringFirst = false;
+		_profileEnd(ofxSceneProfile::UPDATE_ENTER, start);
 	}
 	else if(scene->_bExiting) {
 		scene->updateExit();
 		scene->_bExitingFirst = false;
+		_profileEnd(ofxSceneProfile::UPDATE_EXIT, start);
 	}
 	else {
 		scene->update();
+		_profileEnd(ofxSceneProfile::UPDATE, start);
 	}
 }
 		
@@ -62,13 +80,82 @@ void ofxScene::RunnerScene::draw() {
 	if(!scene->_bSetup) {
 		return;
 	}
+	uint64_t start = _profileStart();
 	scene->draw();
+	_profileEnd(ofxSceneProfile::DRAW, start);
 }
 
 //--------------------------------------------------------------
 void ofxScene::RunnerScene::exit() {
+	if(_loader.valid()) {
+		_finishLoading();
+	}
 	scene->exit();
 	if(!scene->_bSingleSetup) {
 		scene->_bSetup = false;
+		scene->_bLoaded = false;
+	}
+}
+
+//--------------------------------------------------------------
+void ofxScene::RunnerScene::load(ofxThreadPool &pool) {
+	if(scene->_bSetup || scene->_bLoaded || _loader.valid()) {
+		return;
+	}
+	ofxScene *s = scene;
+	_loader = pool.submit([s]() {
+		s->setupAsync();
+	});
+}
+
+//--------------------------------------------------------------
+bool ofxScene::RunnerScene::isLoading() {
+	return _loader.valid() && !isLoaded();
+}
+
+//--------------------------------------------------------------
+bool ofxScene::RunnerScene::isLoaded() {
+	if(_loader.valid() &&
+	   _loader.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+		_finishLoading();
+	}
+	return scene->_bLoaded;
+}
+
+//--------------------------------------------------------------
+void ofxScene::RunnerScene::unload() {
+	if(_loader.valid()) {
+		_finishLoading();
+	}
+	if(scene->_bSetup) {
+		scene->exit();
+	}
+	scene->_bSetup = false;
+	scene->_bLoaded = false;
+}
+
+/* ***** PRIVATE ***** */
+
+//--------------------------------------------------------------
+uint64_t ofxScene::RunnerScene::_profileStart() {
+	return bProfile ? ofxSteadyClock::get() : 0;
+}
+
+//--------------------------------------------------------------
+void ofxScene::RunnerScene::_profileEnd(ofxSceneProfile::Phase phase, uint64_t start) {
+	if(bProfile) {
+		profile.add(phase, (ofxSteadyClock::get() - start) / 1000000.0);
+	}
+}
+
+//--------------------------------------------------------------
+void ofxScene::RunnerScene::_finishLoading() {
+	try {
+		_loader.get();
+	}
+	catch(std::exception &e) {
+		ofLogError("ofxScene") << "\"" << scene->getName()
+			<< "\" setupAsync() failed: " << e.what();
 	}
+	scene->_bLoaded = true;
 }
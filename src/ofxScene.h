@@ -10,8 +10,12 @@
  */
 #pragma once
 
+#include <future>
+
 #include "ofxApp.h"
 #include "ofxTimer.h"
+#include "ofxThreadPool.h"
+#include "ofxSceneProfile.h"
 
 ///	\class  Scene
 ///	\brief  application scene abstract class
@@ -31,7 +35,8 @@ class ofxScene :
 			_name(name), _bSetup(false), _bRunning(true),
 			_bEntering(false), _bEnteringFirst(false),
 			_bExiting(false), _bExitingFirst(false),
-			_bDone(false), _bSingleSetup(singleSetup) {}
+			_bDone(false), _bSingleSetup(singleSetup), _bLoaded(false),
+			_bThreadSafeUpdate(false), _memoryCost(0) {}
 		virtual ~ofxScene() {}
 		
 	/// \section Main
@@ -39,8 +44,16 @@ class ofxScene :
 		/// implement the regular ofBaseApp clalbacks functions
 		/// ie setup(), update(), draw(), etc
 		///
-		/// there are also the following functions for scene enter and exit
-		/// control
+		/// there are also the following functions for background loading
+		/// and scene enter and exit control
+
+		/// called before setup(), on a worker thread when the scene is
+		/// preloaded by the scene manager or on the main thread otherwise
+		///
+		/// load CPU side data here (files, images into ofPixels, etc) and
+		/// create GL resources (textures, fbos, etc) in setup() which is always
+		/// called on the main thread
+		virtual void setupAsync() {}
 
 		/// called when entering
 		virtual void updateEnter() {finishedEntering();};
@@ -95,17 +108,35 @@ class ofxScene :
 
 		/// is the scene already setup?
 		inline bool isSetup()   {return _bSetup;}
+
+		/// has setupAsync() been called?
+		inline bool isLoaded()  {return _bLoaded;}
 		
 		/// controls whether the scene's setup function
 		/// is called only once or each time a scene change is made
 		inline void setSingleSetup(bool single) {_bSingleSetup = single;}
 		inline bool usingSingleSetup()          {return _bSingleSetup;}
+
+		/// get/set the estimated memory used by the scene while setup in bytes,
+		/// used by the scene manager memory budget, default: 0
+		inline void setMemoryCost(std::size_t bytes) {_memoryCost = bytes;}
+		inline std::size_t getMemoryCost()           {return _memoryCost;}
+
+		/// get/set whether update() can run on a worker thread alongside other
+		/// scenes, used by the scene manager for parallel layer updates,
+		/// default: false
+		///
+		/// note: a thread safe update must not draw or touch GL resources
+		inline void setThreadSafeUpdate(bool safe) {_bThreadSafeUpdate = safe;}
+		inline bool isThreadSafeUpdate()           {return _bThreadSafeUpdate;}
 		
 	private:
 	
 		std::string _name; ///< the name of this scene
 		bool _bSetup, _bRunning, _bEntering, _bEnteringFirst,
-			 _bExiting, _bExitingFirst, _bDone, _bSingleSetup;
+			 _bExiting, _bExitingFirst, _bDone, _bSingleSetup, _bLoaded,
+			 _bThreadSafeUpdate;
+		std::size_t _memoryCost; ///< estimated memory use while setup
 
 	public:
 	
@@ -129,8 +160,42 @@ class ofxScene :
 				void update();
 				void draw();
 				void exit();
+
+				/// start calling setupAsync() on a thread pool,
+				/// does nothing if already loaded or loading
+				void load(ofxThreadPool &pool);
+
+				/// is setupAsync() running in the background?
+				bool isLoading();
+
+				/// has setupAsync() finished?
+				bool isLoaded();
+
+				/// calls exit() if setup & resets so the next setup() loads again,
+				/// even when using single setup
+				void unload();
 				
 				ofxScene *scene;
+
+				ofxSceneProfile profile; //< phase timings
+				bool bProfile; //< record phase timings?
+
+			private:
+
+				/// wait for the background load to finish
+				void _finishLoading();
+
+				/// get a phase start time, 0 if not profiling
+				///
+				/// phases are timed with the steady system clock, not the
+				/// ofxTimer clock, so they are measured in wall time even when
+				/// a manual clock is set
+				uint64_t _profileStart();
+
+				/// record a phase time since start, if profiling
+				void _profileEnd(ofxSceneProfile::Phase phase, uint64_t start);
+
+				std::future<void> _loader; //< background setupAsync() result
 		};
 		
 		friend class RunnerScene; //< used to wrap this app
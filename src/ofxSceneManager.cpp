@@ -10,8 +10,15 @@
  */
 #include "ofxSceneManager.h"
 
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+#include "ofAppRunner.h"
 #include "ofEvents.h"
+#include "ofGraphics.h"
 #include "ofLog.h"
+#include "ofxTrace.h"
 
 /// SCENE MANAGER
 
@@ -25,6 +32,26 @@ ofxSceneManager::ofxSceneManager() {
 	_bSignalledAutoChange = false;
 	_sceneChangeTimer.set();
 	_currentScenePtr = NULL;
+	_currentRunnerScenePtr = NULL;
+	_newRunnerScenePtr = NULL;
+	_threadPool = NULL;
+	_bPreloadOnChange = false;
+	_prefetchDepth = 0;
+	_bPrefetchPrevious = false;
+	_bPrefetched = false;
+	_memoryBudget = 0;
+	_useStamp = 0;
+	resetCounters();
+	_bParallelUpdate = false;
+	_transitionFrom = NULL;
+	_transitionTo = NULL;
+	_bTransitioning = false;
+	_bTransitionStarted = false;
+	_bTransitionWaiting = false;
+	_transitionWidth = 0;
+	_transitionHeight = 0;
+	_bProfile = false;
+	_profileSize = 120;
 }
 
 //--------------------------------------------------------------
@@ -33,12 +60,16 @@ ofxScene* ofxSceneManager::add(ofxScene *scene) {
 		ofLogWarning("ofxSceneManager") << "cannot add NULL scene";
 		return NULL;
 	}
-	if(_scenes.find(scene->getName()) != _scenes.end()) {
+	if(_sceneIndices.find(scene->getName()) != _sceneIndices.end()) {
 		ofLogWarning("ofxSceneManager") << "scene \"" << scene->getName()
 									 << "\" already added, only unique names allowed";
 		return NULL;
 	}
-	_scenes.insert(_scenes.end(), std::pair<std::string,ofxScene::RunnerScene*>(scene->getName(), new ofxScene::RunnerScene(scene)));
+	_sceneIndices[scene->getName()] = _scenes.size();
+	_scenes.push_back(new ofxScene::RunnerScene(scene));
+	_scenes.back()->bProfile = _bProfile;
+	_scenes.back()->profile.setSize(_profileSize);
+	_sceneUses.push_back(0);
 	return scene;
 }
 		
@@ -48,43 +79,78 @@ void ofxSceneManager::remove(ofxScene *scene) {
 		ofLogWarning("ofxSceneManager") << "cannot remove NULL scene";
 		return;
 	}
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter;
-	std::map<std::string,ofxScene::RunnerScene*>::iterator diter;
-	for(iter = _scenes.begin(); iter != _scenes.end(); ++iter) {
-		ofxScene::RunnerScene *s = (*iter).second;
-		if(s->scene == scene) {
-			if(s != NULL) {
-				s->exit();
-				delete s;
-			}
-			diter = iter;
-			_scenes.erase(diter);
-			return;
-		}
+	std::unordered_map<std::string,unsigned int>::iterator iter = _sceneIndices.find(scene->getName());
+	if(iter == _sceneIndices.end() || _scenes[iter->second]->scene != scene) {
+		return;
+	}
+	int index = iter->second;
+
+	// removing the current scene leaves no scene
+	if(index == _currentScene) {
+		_currentScene = SCENE_NONE;
+		_currentScenePtr = NULL;
+		_currentRunnerScenePtr = NULL;
+	}
+	else if(index < _currentScene) {
+		_currentScene--;
+	}
+	if(index == _newScene) {
+		_newScene = SCENE_NOCHANGE;
+		_newRunnerScenePtr = NULL;
+	}
+	else if(_newScene != SCENE_NOCHANGE && index < _newScene) {
+		_newScene--;
+	}
+
+	ofxScene::RunnerScene *s = _scenes[index];
+	_loading.erase(std::remove(_loading.begin(), _loading.end(), s), _loading.end());
+	int layer = _findLayer(s);
+	if(layer > -1) {
+		_layers.erase(_layers.begin() + layer);
+	}
+	if(s == _transitionFrom) {
+		_transitionFrom = NULL;
+	}
+	if(s == _transitionTo) {
+		_transitionTo = NULL;
+	}
+	s->exit();
+	delete s;
+	_scenes.erase(_scenes.begin() + index);
+	_sceneUses.erase(_sceneUses.begin() + index);
+	_sceneIndices.erase(iter);
+
+	// shift the following indices down
+	for(unsigned int i = index; i < _scenes.size(); ++i) {
+		_sceneIndices[_scenes[i]->scene->getName()] = i;
 	}
 }
 
 //--------------------------------------------------------------
 void ofxSceneManager::clear() {
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter;
-	for(iter = _scenes.begin(); iter != _scenes.end(); ++iter) {
-		ofxScene::RunnerScene *s = (*iter).second;
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		ofxScene::RunnerScene *s = _scenes[i];
 		if(s != NULL) {
 			s->exit();
 			delete s;
 		}
 	}
 	_scenes.clear();
+	_sceneIndices.clear();
+	_sceneUses.clear();
+	_loading.clear();
+	_layers.clear();
+	_transitionFrom = NULL;
+	_transitionTo = NULL;
+	_bTransitioning = false;
 }
 
 // need to call ofxScene::RunnerScene::setup()
 //--------------------------------------------------------------
 void ofxSceneManager::setup(bool loadAll) {
 	if(loadAll) {
-		std::map<std::string,ofxScene::RunnerScene*>::iterator iter;
-		for(iter = _scenes.begin(); iter != _scenes.end(); ++iter) {
-			ofxScene::RunnerScene *s = (*iter).second;
-			s->setup();
+		for(unsigned int i = 0; i < _scenes.size(); ++i) {
+			_scenes[i]->setup();
 		}
 	} else {	// load the current one only
 		if(!_scenes.empty() && _currentScene >= 0) {
@@ -93,6 +159,286 @@ void ofxSceneManager::setup(bool loadAll) {
 	}
 }
 
+//--------------------------------------------------------------
+void ofxSceneManager::preload(unsigned int index) {
+	ofxScene::RunnerScene *rs = _getRunnerSceneAt(index);
+	if(rs == NULL) {
+		ofLogWarning("ofxSceneManager") << "cannot preload scene " << index << ", index out of range";
+		return;
+	}
+	if(rs->scene->isSetup() || rs->isLoading()) {
+		return;
+	}
+	rs->load(_threadPool != NULL ? *_threadPool : ofxThreadPool::shared());
+	_loading.push_back(rs);
+	_touch(index);
+	ofLogVerbose("ofxSceneManager") << "PRELOAD SCENE: " << index;
+}
+
+void ofxSceneManager::preload(std::string name) {
+	std::unordered_map<std::string,unsigned int>::iterator iter = _sceneIndices.find(name);
+	if(iter == _sceneIndices.end()) {
+		ofLogWarning("ofxSceneManager") << "could not find \"" << name << "\"";
+		return;
+	}
+	preload(iter->second);
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::isSceneReady(unsigned int index) {
+	ofxScene *s = getSceneAt(index);
+	return s == NULL ? false : s->isSetup();
+}
+
+bool ofxSceneManager::isSceneReady(std::string name) {
+	ofxScene *s = getScene(name);
+	return s == NULL ? false : s->isSetup();
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::isSceneLoading(unsigned int index) {
+	ofxScene::RunnerScene *rs = _getRunnerSceneAt(index);
+	return rs == NULL ? false : rs->isLoading();
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setThreadPool(ofxThreadPool *pool) {
+	_threadPool = pool;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setPreloadOnChange(bool preload) {
+	_bPreloadOnChange = preload;
+}
+
+bool ofxSceneManager::getPreloadOnChange() {
+	return _bPreloadOnChange;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setPrefetch(unsigned int depth, bool previous) {
+	_prefetchDepth = depth;
+	_bPrefetchPrevious = previous;
+	_bPrefetched = false;
+}
+
+unsigned int ofxSceneManager::getPrefetchDepth() {
+	return _prefetchDepth;
+}
+
+bool ofxSceneManager::getPrefetchPrevious() {
+	return _bPrefetchPrevious;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setTransition(ofxSceneTransition::Type type, unsigned int durationMS) {
+	_transition.setType(type);
+	_transition.setDuration(durationMS);
+	if(type == ofxSceneTransition::NONE) {
+		_bTransitioning = false;
+	}
+}
+
+ofxSceneTransition& ofxSceneManager::getTransition() {
+	return _transition;
+}
+
+bool ofxSceneManager::isTransitioning() {
+	return _bTransitioning;
+}
+
+void ofxSceneManager::setTransitionSize(int w, int h) {
+	_transitionWidth = w;
+	_transitionHeight = h;
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::addLayer(unsigned int index, int order) {
+	ofxScene::RunnerScene *rs = _getRunnerSceneAt(index);
+	if(rs == NULL) {
+		ofLogWarning("ofxSceneManager") << "cannot add layer " << index << ", index out of range";
+		return false;
+	}
+	if(_findLayer(rs) > -1) {
+		ofLogWarning("ofxSceneManager") << "scene \"" << rs->scene->getName()
+			<< "\" is already a layer";
+		return false;
+	}
+
+	_insertLayer(rs, order);
+	ofLogVerbose("ofxSceneManager") << "ADD LAYER: " << index << " ORDER: " << order;
+	return true;
+}
+
+bool ofxSceneManager::addLayer(std::string name, int order) {
+	int index = getSceneIndex(name);
+	if(index < 0) {
+		ofLogWarning("ofxSceneManager") << "could not find \"" << name << "\"";
+		return false;
+	}
+	return addLayer(index, order);
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::removeLayer(unsigned int index) {
+	int layer = _findLayer(_getRunnerSceneAt(index));
+	if(layer < 0) {
+		return;
+	}
+	ofxScene::RunnerScene *rs = _layers[layer].scene;
+	_layers.erase(_layers.begin() + layer);
+	if(!_isActive(rs)) {
+		rs->exit();
+	}
+	ofLogVerbose("ofxSceneManager") << "REMOVE LAYER: " << index;
+}
+
+void ofxSceneManager::removeLayer(std::string name) {
+	int index = getSceneIndex(name);
+	if(index < 0) {
+		ofLogWarning("ofxSceneManager") << "could not find \"" << name << "\"";
+		return;
+	}
+	removeLayer(index);
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::clearLayers() {
+	for(unsigned int i = 0; i < _layers.size(); ++i) {
+		if(!_isActive(_layers[i].scene)) {
+			_layers[i].scene->exit();
+		}
+	}
+	_layers.clear();
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setLayerOrder(unsigned int index, int order) {
+	int layer = _findLayer(_getRunnerSceneAt(index));
+	if(layer < 0) {
+		return;
+	}
+	ofxScene::RunnerScene *rs = _layers[layer].scene;
+	_layers.erase(_layers.begin() + layer);
+	_insertLayer(rs, order);
+}
+
+int ofxSceneManager::getLayerOrder(unsigned int index) {
+	int layer = _findLayer(_getRunnerSceneAt(index));
+	return layer < 0 ? 0 : _layers[layer].order;
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::isLayer(unsigned int index) {
+	return _findLayer(_getRunnerSceneAt(index)) > -1;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setParallelUpdate(bool parallel) {
+	_bParallelUpdate = parallel;
+}
+
+bool ofxSceneManager::getParallelUpdate() {
+	return _bParallelUpdate;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setMemoryBudget(std::size_t bytes) {
+	_memoryBudget = bytes;
+}
+
+std::size_t ofxSceneManager::getMemoryBudget() {
+	return _memoryBudget;
+}
+
+std::size_t ofxSceneManager::getMemoryUsage() {
+	std::size_t usage = 0;
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		if(_isResident(_scenes[i])) {
+			usage += _scenes[i]->scene->getMemoryCost();
+		}
+	}
+	return usage;
+}
+
+//--------------------------------------------------------------
+unsigned int ofxSceneManager::getNumHits() {
+	return _numHits;
+}
+
+unsigned int ofxSceneManager::getNumMisses() {
+	return _numMisses;
+}
+
+unsigned int ofxSceneManager::getNumEvictions() {
+	return _numEvictions;
+}
+
+void ofxSceneManager::resetCounters() {
+	_numHits = 0;
+	_numMisses = 0;
+	_numEvictions = 0;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::setProfiling(bool profile, unsigned int windowSize) {
+	_bProfile = profile;
+	if(windowSize != _profileSize) {
+		_profileSize = windowSize;
+		for(unsigned int i = 0; i < _scenes.size(); ++i) {
+			_scenes[i]->profile.setSize(windowSize);
+		}
+	}
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		_scenes[i]->bProfile = profile;
+	}
+}
+
+bool ofxSceneManager::getProfiling() {
+	return _bProfile;
+}
+
+//--------------------------------------------------------------
+ofxSceneProfile* ofxSceneManager::getSceneProfile(unsigned int index) {
+	ofxScene::RunnerScene *rs = _getRunnerSceneAt(index);
+	return rs == NULL ? NULL : &rs->profile;
+}
+
+ofxSceneProfile* ofxSceneManager::getSceneProfile(std::string name) {
+	int index = getSceneIndex(name);
+	return index < 0 ? NULL : getSceneProfile(index);
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::clearProfiles() {
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		_scenes[i]->profile.clear();
+	}
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::drawProfile(float x, float y) {
+	if(_currentRunnerScenePtr == NULL || _currentScene < 0) {
+		return;
+	}
+	ofxSceneProfile &profile = _currentRunnerScenePtr->profile;
+	std::ostringstream text;
+	text << _currentScenePtr->getName() << " (ms)  p50    p95    p99";
+	text << std::fixed << std::setprecision(2);
+	for(int i = 0; i < ofxSceneProfile::NUM_PHASES; ++i) {
+		ofxSceneProfile::Phase phase = (ofxSceneProfile::Phase) i;
+		ofxTimingStats &stats = profile.get(phase);
+		if(stats.getCount() == 0) {
+			continue;
+		}
+		text << std::endl << std::left << std::setw(12) << ofxSceneProfile::getPhaseName(phase)
+		     << std::right << std::setw(6) << stats.p50() << " "
+		     << std::setw(6) << stats.p95() << " "
+		     << std::setw(6) << stats.p99();
+	}
+	ofDrawBitmapStringHighlight(text.str(), x, y);
+}
+
 //--------------------------------------------------------------
 void ofxSceneManager::run(bool run) {
 	if(!_scenes.empty() && _currentScene >= 0) {
@@ -122,6 +468,10 @@ void ofxSceneManager::noScene(bool now) {
 	}
 	if(!now && _currentScene > -1) {
 		_currentScenePtr->startExiting();
+		_startTransition(NULL);
+	}
+	else {
+		_bTransitioning = false;
 	}
 	_bChangeNow = now;
 	_newScene = SCENE_NONE;
@@ -170,6 +520,16 @@ void ofxSceneManager::gotoScene(unsigned int index, bool now) {
 		s = getSceneAt(index);
 		s->startEntering();
 		_newRunnerScenePtr = _getRunnerSceneAt(index);
+
+		// load while the current scene is exiting
+		if(_bPreloadOnChange && !_bOverlap && _currentScene > SCENE_NONE) {
+			preload(index);
+		}
+
+		_startTransition(_newRunnerScenePtr);
+	}
+	else {
+		_bTransitioning = false;
 	}
 	
 	_newScene = index;
@@ -178,20 +538,19 @@ void ofxSceneManager::gotoScene(unsigned int index, bool now) {
 }
 
 //--------------------------------------------------------------
-// using the std::distance func to turn iter into index
 void ofxSceneManager::gotoScene(std::string name, bool now) {
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter = _scenes.find(name);
-	if(iter == _scenes.end()) {
+	std::unordered_map<std::string,unsigned int>::iterator iter = _sceneIndices.find(name);
+	if(iter == _sceneIndices.end()) {
 		ofLogWarning("ofxSceneManager") << "could not find \"" << name << "\"";
 		return;
 	}
-	gotoScene(std::distance(_scenes.begin(), iter), now);
+	gotoScene(iter->second, now);
 }
 
 //--------------------------------------------------------------
 ofxScene* ofxSceneManager::getScene(std::string name) {
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter = _scenes.find(name);
-	return iter != _scenes.end() ? iter->second->scene : NULL;
+	std::unordered_map<std::string,unsigned int>::iterator iter = _sceneIndices.find(name);
+	return iter != _sceneIndices.end() ? _scenes[iter->second]->scene : NULL;
 }
 
 ofxScene* ofxSceneManager::getSceneAt(unsigned int index) {
@@ -204,10 +563,9 @@ std::string ofxSceneManager::getSceneName(unsigned int index) {
 	return s == NULL ? "" : s->getName();
 }
 
-// using the std::distance func to turn iter into index
 int ofxSceneManager::getSceneIndex(std::string name) {
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter = _scenes.find(name);
-	return iter != _scenes.end() ? std::distance(_scenes.begin(), iter) : -1;
+	std::unordered_map<std::string,unsigned int>::iterator iter = _sceneIndices.find(name);
+	return iter != _sceneIndices.end() ? (int) iter->second : -1;
 }
 
 //--------------------------------------------------------------
@@ -246,6 +604,7 @@ bool ofxSceneManager::getOverlap() {
 // need to call ofxScene::RunnerScene::update()
 void ofxSceneManager::update() {
 
+	_finishLoading();
 	_handleSceneChanges();
 
 	// update the current main scene
@@ -258,6 +617,12 @@ void ofxSceneManager::update() {
 		}
 		_currentRunnerScenePtr->update();
 
+		// load the scenes around this one once it's entered
+		if(!_bPrefetched && !s->isEntering()) {
+			_prefetch();
+			_bPrefetched = true;
+		}
+
 		// if this scene says it's done, go to the next one
 		if(s->isDone() && !_bSignalledAutoChange) {
 			nextScene();
@@ -273,24 +638,43 @@ void ofxSceneManager::update() {
 		}
 		_newRunnerScenePtr->update();
 	}
+
+	_updateLayers();
+
+	if(_memoryBudget > 0) {
+		_enforceBudget();
+	}
 }
 
 // need to call ofxScene::RunnerScene::draw()
 void ofxSceneManager::draw() {
-	if(!_scenes.empty() && _currentScene >= 0) {
-		_currentRunnerScenePtr->draw();
+	_drawLayers(INT_MIN, -1);
+
+	// buffers are only reallocated when the size changes
+	if(_transition.getType() != ofxSceneTransition::NONE) {
+		_transition.allocate(_transitionWidth > 0 ? _transitionWidth : ofGetWidth(),
+		                     _transitionHeight > 0 ? _transitionHeight : ofGetHeight());
 	}
-	if(_bOverlap && !_scenes.empty() && _newScene != SCENE_NOCHANGE && _newScene >= 0) {
-		_newRunnerScenePtr->draw();
+
+	if(_bTransitioning) {
+		_drawTransition();
 	}
+	else {
+		if(!_scenes.empty() && _currentScene >= 0) {
+			_currentRunnerScenePtr->draw();
+		}
+		if(_bOverlap && !_scenes.empty() && _newScene != SCENE_NOCHANGE && _newScene >= 0) {
+			_newRunnerScenePtr->draw();
+		}
+	}
+
+	_drawLayers(0, INT_MAX);
 }
 
 // call resize on all scenes
 void ofxSceneManager::windowResized(int w, int h) {
-	std::map<std::string,ofxScene::RunnerScene*>::iterator iter;
-	for(iter = _scenes.begin(); iter != _scenes.end(); ++iter) {
-		ofxScene::RunnerScene *s = (*iter).second;
-		s->windowResized(w, h);
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		_scenes[i]->windowResized(w, h);
 	}
 }
 
@@ -413,10 +797,8 @@ void ofxSceneManager::gotMemoryWarning() {
 
 // call on all scenes
 void ofxSceneManager::deviceOrientationChanged(int newOrientation) {
-	map<std::string,ofxScene::RunnerScene*>::iterator iter;
-	for(iter = _scenes.begin(); iter != _scenes.end(); ++iter) {
-		ofxScene::RunnerScene *s = (*iter).second;
-		s->deviceOrientationChanged(newOrientation);
+	for(unsigned int i = 0; i < _scenes.size(); ++i) {
+		_scenes[i]->deviceOrientationChanged(newOrientation);
 	}
 }
 #endif
@@ -476,6 +858,7 @@ void ofxSceneManager::audioRequested(float *output, int bufferSize, int nChannel
 
 //--------------------------------------------------------------
 void ofxSceneManager::_handleSceneChanges() {
+	OFX_TRACE_SCOPE("ofxSceneManager::_handleSceneChanges");
 
 	// do the actual main scene change
 	if(_newScene != SCENE_NOCHANGE) {
@@ -509,6 +892,7 @@ void ofxSceneManager::_handleSceneChanges() {
 
 //--------------------------------------------------------------
 void ofxSceneManager::changeToNewScene() {
+	OFX_TRACE_SCOPE("ofxSceneManager::changeToNewScene");
 	
 	_currentScene = _newScene;
 	_currentRunnerScenePtr = _getRunnerSceneAt(_currentScene);
@@ -516,6 +900,13 @@ void ofxSceneManager::changeToNewScene() {
 
 	if(_currentRunnerScenePtr) {
 		_currentScenePtr = _currentRunnerScenePtr->scene;
+		if(_currentScenePtr->isSetup()) {
+			_numHits++;
+		}
+		else {
+			_numMisses++;
+		}
+		_touch(_currentScene);
 		ofLogVerbose("ofxSceneManager") << "changed to " << _currentScene
 			<< " \"" << _currentScenePtr->getName() << "\"";
 	}
@@ -524,17 +915,218 @@ void ofxSceneManager::changeToNewScene() {
 		ofLogVerbose("ofxSceneManager") << "changed to NO_SCENE";
 	}
 	
+	// the incoming scene draws from now on
+	if(_bTransitionWaiting) {
+		_transitionTimer.setAlarm(_transition.getDuration());
+		_bTransitionWaiting = false;
+	}
+
 	_newScene = SCENE_NOCHANGE; // done
 	_bSignalledAutoChange = false;
+	_bPrefetched = false;
 	_sceneChangeTimer.set();
 }
 
+//--------------------------------------------------------------
+void ofxSceneManager::_finishLoading() {
+	for(unsigned int i = 0; i < _loading.size(); ++i) {
+		ofxScene::RunnerScene *rs = _loading[i];
+		if(rs->scene->isSetup()) { // already setup on a scene change
+			_loading.erase(_loading.begin() + i);
+			--i;
+		}
+		else if(rs->isLoaded()) {
+			rs->setup();
+			_loading.erase(_loading.begin() + i);
+			ofLogVerbose("ofxSceneManager") << "PRELOADED SCENE: \"" << rs->scene->getName() << "\"";
+			return;
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_prefetch() {
+	int num = _scenes.size();
+	int depth = std::min((int) _prefetchDepth, num - 1);
+	for(int i = 1; i <= depth; ++i) {
+		preload((_currentScene + i) % num);
+		if(_bPrefetchPrevious) {
+			int prev = (_currentScene - i + num) % num;
+			if(_scenes[prev]->scene->usingSingleSetup()) {
+				preload(prev);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_touch(int index) {
+	_sceneUses[index] = ++_useStamp;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_enforceBudget() {
+	std::size_t usage = getMemoryUsage();
+	while(usage > _memoryBudget) {
+
+		// find the least recently used scene which can be unloaded
+		int lru = -1;
+		for(unsigned int i = 0; i < _scenes.size(); ++i) {
+			ofxScene::RunnerScene *rs = _scenes[i];
+			if((int) i == _currentScene || (int) i == _newScene || _findLayer(rs) > -1 ||
+			   !_isResident(rs) || rs->scene->getMemoryCost() == 0 ||
+			   std::find(_loading.begin(), _loading.end(), rs) != _loading.end()) {
+				continue;
+			}
+			if(lru < 0 || _sceneUses[i] < _sceneUses[lru]) {
+				lru = i;
+			}
+		}
+		if(lru < 0) { // nothing left to unload
+			return;
+		}
+
+		ofxScene *s = _scenes[lru]->scene;
+		usage -= s->getMemoryCost();
+		_scenes[lru]->unload();
+		_numEvictions++;
+		ofLogVerbose("ofxSceneManager") << "UNLOADED SCENE: \"" << s->getName() << "\"";
+	}
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::_isResident(ofxScene::RunnerScene *rs) {
+	return rs->scene->isSetup() || rs->scene->isLoaded() || rs->isLoading();
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_startTransition(ofxScene::RunnerScene *to) {
+	if(_transition.getType() == ofxSceneTransition::NONE) {
+		return;
+	}
+	_transitionFrom = (_currentScene >= 0) ? _currentRunnerScenePtr : NULL;
+	_transitionTo = to;
+	_bTransitioning = true;
+	_bTransitionStarted = false;
+
+	// without overlap, the incoming scene isn't drawn until the outgoing
+	// scene has exited, so start the timer then
+	_bTransitionWaiting = (!_bOverlap && _transitionFrom != NULL);
+	if(!_bTransitionWaiting) {
+		_transitionTimer.setAlarm(_transition.getDuration());
+	}
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_drawTransition() {
+
+	// clear frames left over from the last transition
+	if(!_bTransitionStarted) {
+		if(_transitionFrom == NULL) {
+			_transition.beginFrom();
+			_transition.endFrom();
+		}
+		_transition.clearTo();
+		_bTransitionStarted = true;
+	}
+
+	// inactive scenes keep their last frame
+	if(_transitionFrom != NULL && _isActive(_transitionFrom)) {
+		_transition.beginFrom();
+		_transitionFrom->draw();
+		_transition.endFrom();
+	}
+	if(_transitionTo != NULL && _isActive(_transitionTo)) {
+		_transition.beginTo();
+		_transitionTo->draw();
+		_transition.endTo();
+	}
+
+	float t = 0;
+	if(!_bTransitionWaiting) {
+		t = (_transition.getDuration() == 0) ? 1 : _transitionTimer.getDiffN();
+	}
+	_transition.draw(t);
+
+	// done once the scene change has finished
+	if(t >= 1 && _newScene == SCENE_NOCHANGE) {
+		_bTransitioning = false;
+		_transitionFrom = NULL;
+		_transitionTo = NULL;
+	}
+}
+
+//--------------------------------------------------------------
+int ofxSceneManager::_findLayer(ofxScene::RunnerScene *rs) {
+	for(unsigned int i = 0; i < _layers.size(); ++i) {
+		if(_layers[i].scene == rs) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_insertLayer(ofxScene::RunnerScene *rs, int order) {
+
+	// insert after layers with the same order
+	std::vector<Layer>::iterator iter = _layers.begin();
+	while(iter != _layers.end() && iter->order <= order) {
+		++iter;
+	}
+	Layer layer = {rs, order};
+	_layers.insert(iter, layer);
+}
+
+//--------------------------------------------------------------
+bool ofxSceneManager::_isActive(ofxScene::RunnerScene *rs) {
+	return (_currentScene >= 0 && rs == _currentRunnerScenePtr) ||
+	       (_bOverlap && _newScene >= 0 && rs == _newRunnerScenePtr);
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_updateLayers() {
+	_parallelLayers.clear();
+	for(unsigned int i = 0; i < _layers.size(); ++i) {
+		ofxScene::RunnerScene *rs = _layers[i].scene;
+		if(_isActive(rs)) {
+			continue; // already updated
+		}
+		if(!rs->scene->isSetup()) { // setup on the main thread
+			rs->setup();
+		}
+		if(_bParallelUpdate && rs->scene->isThreadSafeUpdate()) {
+			_parallelLayers.push_back(rs);
+		}
+		else {
+			rs->update();
+		}
+	}
+	if(!_parallelLayers.empty()) {
+		ofxThreadPool &pool = (_threadPool != NULL ? *_threadPool : ofxThreadPool::shared());
+		pool.parallelFor(_parallelLayers.size(), 1, [this](unsigned int begin, unsigned int end) {
+			for(unsigned int i = begin; i < end; ++i) {
+				_parallelLayers[i]->update();
+			}
+		});
+	}
+}
+
+//--------------------------------------------------------------
+void ofxSceneManager::_drawLayers(int minOrder, int maxOrder) {
+	for(unsigned int i = 0; i < _layers.size(); ++i) {
+		const Layer &layer = _layers[i];
+		if(layer.order < minOrder || layer.order > maxOrder || _isActive(layer.scene)) {
+			continue;
+		}
+		layer.scene->draw();
+	}
+}
+
 //--------------------------------------------------------------
 ofxScene::RunnerScene* ofxSceneManager::_getRunnerSceneAt(int index) {
-	if(index < _scenes.size()) {
-		std::map<std::string,ofxScene::RunnerScene*>::iterator iter = _scenes.begin();
-		std::advance(iter, index);
-		return (*iter).second;
+	if(index >= 0 && index < (int) _scenes.size()) {
+		return _scenes[index];
 	}
 	return NULL;
 }
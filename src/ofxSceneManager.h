@@ -10,15 +10,20 @@
  */
 #pragma once
 
-#include <map>
+#include <vector>
+#include <unordered_map>
 #include <climits>
 
 #include "ofxApp.h"
 #include "ofxScene.h"
 #include "ofxTimer.h"
+#include "ofxThreadPool.h"
+#include "ofxSceneTransition.h"
 
 ///	\class	SceneManager
-///	\brief	a map based scene manager
+///	\brief	a scene manager with index & name lookup
+///
+/// scenes are indexed in the order they are added
 class ofxSceneManager {
 	public:
 
@@ -42,7 +47,163 @@ class ofxSceneManager {
 		///
 		/// unloaded scenes are automatically loaded on their first update
 		void setup(bool loadAll=true);
+
+	/// \section Background Loading
+
+		/// start loading a scene in the background: the scene's setupAsync() is
+		/// called on a worker thread, then setup() is called on the main thread
+		/// in update() once it's finished
+		///
+		/// does nothing if the scene is already setup or loading
+		///
+		/// note: the preloaded scene's setup() may be called before the current
+		///       scene's exit(), don't preload scenes which share resources
+		///       released in exit() with the current scene
+		void preload(unsigned int index);
+		void preload(std::string name);
+
+		/// get/set preloading the new scene while the current scene is exiting
+		/// on scene changes which are not done "now", default: false
+		///
+		/// note: the new scene's setup() is then called before the current
+		///       scene's exit()
+		void setPreloadOnChange(bool preload);
+		bool getPreloadOnChange();
+
+		/// is a scene setup & ready to enter without blocking?
+		bool isSceneReady(unsigned int index);
+		bool isSceneReady(std::string name);
+
+		/// is a scene currently loading in the background?
+		bool isSceneLoading(unsigned int index);
+
+		/// set the thread pool used for background loading,
+		/// NULL uses the shared pool (default)
+		void setThreadPool(ofxThreadPool *pool);
+
+		/// get/set how many of the following (and optionally previous) scenes
+		/// to preload once the current scene has finished entering, 0 disables
+		/// (default)
+		///
+		/// scenes wrap around like nextScene() & prevScene()
+		///
+		/// only single setup scenes are prefetched backwards, as the scene just
+		/// left would otherwise be setup again right after its exit()
+		void setPrefetch(unsigned int depth, bool previous=false);
+		unsigned int getPrefetchDepth();
+		bool getPrefetchPrevious();
 		
+	/// \section Transitions
+
+		/// set the transition used for scene changes which are not done "now",
+		/// ofxSceneTransition::NONE draws the scenes directly (default)
+		///
+		/// the outgoing & incoming scenes are drawn into offscreen buffers which
+		/// are composited over the duration
+		///
+		/// when overlapping, the transition starts on the scene change, otherwise
+		/// it starts once the outgoing scene has exited & the incoming scene is
+		/// drawn, compositing against the outgoing scene's last frame
+		void setTransition(ofxSceneTransition::Type type, unsigned int durationMS=1000);
+
+		/// get the transition for settings & buffer access
+		ofxSceneTransition& getTransition();
+
+		/// is a transition currently being drawn?
+		bool isTransitioning();
+
+		/// set the transition buffer size, 0 uses the window size (default)
+		///
+		/// note: ofxApp sets this to its render size
+		void setTransitionSize(int w, int h);
+
+	/// \section Layers
+
+		/// add a scene as a layer which is updated & drawn along with the
+		/// current scene, ie. a background or HUD overlay
+		///
+		/// layers are drawn by order: the current scene is at 0, layers with
+		/// negative orders are drawn below it & the rest above it, layers with
+		/// the same order are drawn in the order they were added
+		///
+		/// layers are setup on their first update, do not use enter/exit
+		/// transitions, & only the current scene receives input events
+		///
+		/// returns false if the scene was not found or is already a layer
+		bool addLayer(unsigned int index, int order=1);
+		bool addLayer(std::string name, int order=1);
+
+		/// remove a layer, calls its exit()
+		void removeLayer(unsigned int index);
+		void removeLayer(std::string name);
+
+		/// remove all layers
+		void clearLayers();
+
+		/// get/set a layer's draw order, returns 0 if the scene is not a layer
+		void setLayerOrder(unsigned int index, int order);
+		int getLayerOrder(unsigned int index);
+
+		/// is a scene currently a layer?
+		bool isLayer(unsigned int index);
+
+		/// get the number of layers
+		unsigned int getNumLayers() {return _layers.size();}
+
+		/// enable/disable updating layers with a thread safe update
+		/// (see ofxScene::setThreadSafeUpdate) in parallel on the background
+		/// loading thread pool, default: false
+		///
+		/// the current & transitioning scenes are always updated on the main thread
+		void setParallelUpdate(bool parallel);
+		bool getParallelUpdate();
+
+	/// \section Memory Budget
+
+		/// get/set the total memory budget for setup scenes in bytes,
+		/// 0 is unlimited (default)
+		///
+		/// when the memory costs of the setup & loaded scenes go over budget,
+		/// the least recently used scenes are unloaded: exit() is called and
+		/// they will be setup again when next used, even with single setup
+		///
+		/// the current & next scenes and scenes still loading are not unloaded
+		///
+		/// note: set each scene's cost with ofxScene::setMemoryCost()
+		void setMemoryBudget(std::size_t bytes);
+		std::size_t getMemoryBudget();
+
+		/// get the memory costs of the setup & loaded scenes in bytes
+		std::size_t getMemoryUsage();
+
+		/// residency counters: a hit is a scene change to a scene which was
+		/// already setup, a miss had to be setup, & an eviction is a scene
+		/// unloaded to stay within the budget
+		unsigned int getNumHits();
+		unsigned int getNumMisses();
+		unsigned int getNumEvictions();
+		void resetCounters();
+
+	/// \section Profiling
+
+		/// enable/disable recording the setup, updateEnter, update, updateExit,
+		/// & draw timings of each scene, window size is the number of samples
+		/// kept for the percentiles (up to ofxTimingStats::CAPACITY),
+		/// default: off
+		void setProfiling(bool profile, unsigned int windowSize=120);
+		bool getProfiling();
+
+		/// get a scene's timings, returns NULL if the scene was not found
+		ofxSceneProfile* getSceneProfile(unsigned int index);
+		ofxSceneProfile* getSceneProfile(std::string name);
+
+		/// clear the timings of all scenes
+		void clearProfiles();
+
+		/// draw the current scene timing percentiles in ms, drawn automatically
+		/// by ofxApp in debug mode when profiling
+		void drawProfile(float x, float y);
+
 	/// \section Scene Control
 		
 		/// play/pause the current scene
@@ -157,8 +318,52 @@ class ofxSceneManager {
 		/// do actual scene change
 		void changeToNewScene();
 		
-		/// wrapper around iter + advance
+		/// returns NULL if index is out of range
 		ofxScene::RunnerScene* _getRunnerSceneAt(int index);
+
+		/// call setup() on the next background loaded scene, only one per
+		/// update to spread out GL resource creation
+		void _finishLoading();
+
+		/// preload the scenes around the current scene
+		void _prefetch();
+
+		/// mark a scene as recently used
+		void _touch(int index);
+
+		/// unload least recently used scenes until within the memory budget
+		void _enforceBudget();
+
+		/// is a scene taking up memory?
+		bool _isResident(ofxScene::RunnerScene *rs);
+
+		/// start a transition from the current scene to a new scene, if set
+		void _startTransition(ofxScene::RunnerScene *to);
+
+		/// draw the outgoing & incoming scenes into the transition buffers
+		/// & composite them
+		void _drawTransition();
+
+		/// find a layer by runner scene, returns -1 if not found
+		int _findLayer(ofxScene::RunnerScene *rs);
+
+		/// insert a layer after the layers with the same or lower order
+		void _insertLayer(ofxScene::RunnerScene *rs, int order);
+
+		/// is a scene being updated & drawn as the current or new scene?
+		bool _isActive(ofxScene::RunnerScene *rs);
+
+		/// update all layers which are not active scenes
+		void _updateLayers();
+
+		/// draw layers within an order range which are not active scenes
+		void _drawLayers(int minOrder, int maxOrder);
+
+		/// a scene drawn along with the current scene
+		struct Layer {
+			ofxScene::RunnerScene *scene; //< layer scene
+			int order; //< compositing order, current scene is 0
+		};
 	
 		/// valid scene index value enums
 		enum {
@@ -174,10 +379,43 @@ class ofxSceneManager {
 		bool _bChangeNow;  //< ignore enter and exit when changing scenes?
 		bool _bOverlap;    //< make new scenes start entering while current scene is finishing?
 		
-		std::map<std::string,ofxScene::RunnerScene*> _scenes; //< scenes
+		std::vector<ofxScene::RunnerScene*> _scenes; //< scenes in the order they were added
+		std::unordered_map<std::string,unsigned int> _sceneIndices; //< scene indices by name
 	
 		bool _bSignalledAutoChange;    //< has an automatic change been called?
 		unsigned int _minChangeTimeMS; //< minimum ms to wait before accepting scene change commands
 
 		ofxTimer _sceneChangeTimer;    //< timers to keep track of change times
+
+		std::vector<ofxScene::RunnerScene*> _loading; //< scenes loading in the background
+		ofxThreadPool *_threadPool; //< background loading pool, NULL for shared
+		bool _bPreloadOnChange; //< preload the new scene on scene changes?
+
+		unsigned int _prefetchDepth; //< number of scenes to prefetch each way
+		bool _bPrefetchPrevious;     //< prefetch previous scenes too?
+		bool _bPrefetched;           //< has the current scene prefetched?
+
+		std::size_t _memoryBudget;  //< memory budget in bytes, 0 for unlimited
+		std::vector<uint64_t> _sceneUses; //< last use stamp per scene
+		uint64_t _useStamp;         //< current use stamp
+		unsigned int _numHits;      //< scene changes to setup scenes
+		unsigned int _numMisses;    //< scene changes to scenes needing setup
+		unsigned int _numEvictions; //< scenes unloaded to stay within the budget
+
+		std::vector<Layer> _layers; //< layers sorted by draw order
+		std::vector<ofxScene::RunnerScene*> _parallelLayers; //< layers to update in parallel
+		bool _bParallelUpdate; //< update thread safe layers in parallel?
+
+		ofxSceneTransition _transition; //< scene change transition & buffers
+		ofxScene::RunnerScene *_transitionFrom; //< outgoing scene, NULL for none
+		ofxScene::RunnerScene *_transitionTo;   //< incoming scene, NULL for none
+		bool _bTransitioning;      //< is a transition running?
+		bool _bTransitionStarted;  //< have the buffers been cleared for this transition?
+		bool _bTransitionWaiting;  //< waiting for the incoming scene to start the timer?
+		int _transitionWidth;      //< transition buffer width, 0 for window width
+		int _transitionHeight;     //< transition buffer height, 0 for window height
+		ofxTimer _transitionTimer; //< transition progress
+
+		bool _bProfile; //< record scene timings?
+		unsigned int _profileSize; //< scene timings window size
 };
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "ofxMovingStats.h"
+
+/// rolling timing statistics with percentiles
+///
+/// the samples are kept in an ofxMovingStats window, percentiles are computed
+/// from a sorted copy which is only re-sorted when new samples have been added
+class ofxTimingStats {
+
+	public:
+
+		/// max window size in samples
+		static const std::size_t CAPACITY = 600;
+
+		/// specified window size in samples, clamped to the capacity
+		ofxTimingStats(unsigned int size=120) : bSorted(true) {
+			setSize(size);
+		}
+
+		/// add a new sample
+		void add(double val) {
+			samples.add(val);
+			bSorted = false;
+		}
+
+		/// get a percentile of the current samples, p is 0-100,
+		/// uses the nearest rank, 0 if empty
+		double percentile(double p) {
+			unsigned int count = getCount();
+			if(count == 0) {
+				return 0;
+			}
+			_sort();
+			double rank = std::ceil(p / 100.0 * count);
+			unsigned int i = (rank < 1) ? 0 : (unsigned int) rank - 1;
+			return sorted[std::min(i, count - 1)];
+		}
+
+		/// common percentiles
+		double p50() {return percentile(50);}
+		double p95() {return percentile(95);}
+		double p99() {return percentile(99);}
+
+		/// get the mean & largest current sample, 0 if empty
+		double avg() {return samples.avg();}
+		double max() {return samples.max();}
+
+		/// get the newest sample, 0 if empty
+		double last() {return samples.last();}
+
+		/// get the number of current samples
+		unsigned int getCount() {return samples.getCount();}
+
+		/// set (resize) the window size, clamped to the capacity,
+		/// clears the current samples
+		void setSize(unsigned int size) {
+			samples.setSize((size > 0) ? size : 1);
+			sorted.reserve(samples.size());
+			clear();
+		}
+
+		/// get the window size
+		unsigned int size() {return samples.size();}
+
+		/// clear the current samples
+		void clear() {
+			samples.clear();
+			sorted.clear();
+			bSorted = true;
+		}
+
+		/// get the moving window of samples
+		ofxMovingStats<double, CAPACITY>& getSamples() {return samples;}
+
+	protected:
+
+		/// sort a copy of the samples if there are new samples
+		void _sort() {
+			if(bSorted) {
+				return;
+			}
+			sorted.resize(samples.getCount());
+			for(unsigned int i = 0; i < sorted.size(); ++i) {
+				sorted[i] = samples.get(i);
+			}
+			std::sort(sorted.begin(), sorted.end());
+			bSorted = true;
+		}
+
+		ofxMovingStats<double, CAPACITY> samples; //< moving window of samples
+		std::vector<double> sorted; //< sorted copy of the samples
+		bool bSorted; //< is the sorted copy up to date?
+};
+
+///	\class  ofxSceneProfile
+///	\brief  rolling ms timings for each ofxScene phase
+class ofxSceneProfile {
+
+	public:
+
+		/// scene phases
+		enum Phase {
+			SETUP,
+			UPDATE_ENTER,
+			UPDATE,
+			UPDATE_EXIT,
+			DRAW,
+			NUM_PHASES
+		};
+
+		/// specified window size in samples for each phase
+		ofxSceneProfile(unsigned int size=120) {
+			setSize(size);
+		}
+
+		/// add a phase timing in ms
+		void add(Phase phase, double ms) {phases[phase].add(ms);}
+
+		/// get the timing stats for a phase
+		ofxTimingStats& get(Phase phase) {return phases[phase];}
+
+		/// get a phase name
+		static const char* getPhaseName(Phase phase) {
+			static const char *names[NUM_PHASES] = {
+				"setup", "updateEnter", "update", "updateExit", "draw"
+			};
+			return (phase < NUM_PHASES) ? names[phase] : "unknown";
+		}
+
+		/// set (resize) the window size of all phases, clears the timings
+		void setSize(unsigned int size) {
+			for(int i = 0; i < NUM_PHASES; ++i) {
+				phases[i].setSize(size);
+			}
+		}
+
+		/// clear all timings
+		void clear() {
+			for(int i = 0; i < NUM_PHASES; ++i) {
+				phases[i].clear();
+			}
+		}
+
+	protected:
+
+		ofxTimingStats phases[NUM_PHASES]; //< timings per phase
+};
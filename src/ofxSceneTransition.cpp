@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#include "ofxSceneTransition.h"
+
+#include <algorithm>
+
+#include "ofGraphics.h"
+#include "ofLog.h"
+
+//--------------------------------------------------------------
+ofxSceneTransition::ofxSceneTransition(Type type, unsigned int durationMS) {
+	this->type = type;
+	duration = durationMS;
+	width = 0;
+	height = 0;
+	dissolveMesh.setMode(OF_PRIMITIVE_TRIANGLES);
+	dissolveMesh.setUsage(GL_STREAM_DRAW);
+	setDissolveCells(64, 36);
+}
+
+//--------------------------------------------------------------
+void ofxSceneTransition::allocate(int w, int h) {
+	if(w == width && h == height && isAllocated()) {
+		return;
+	}
+	from.allocate(w, h, GL_RGBA);
+	to.allocate(w, h, GL_RGBA);
+	width = w;
+	height = h;
+	ofLogVerbose("ofxSceneTransition") << "allocated " << w << "x" << h << " buffers";
+}
+
+bool ofxSceneTransition::isAllocated() {
+	return from.isAllocated() && to.isAllocated();
+}
+
+//--------------------------------------------------------------
+void ofxSceneTransition::beginFrom() {
+	from.begin();
+	ofClear(0, 0, 0, 0);
+}
+
+void ofxSceneTransition::endFrom() {
+	from.end();
+}
+
+//--------------------------------------------------------------
+void ofxSceneTransition::beginTo() {
+	to.begin();
+	ofClear(0, 0, 0, 0);
+}
+
+void ofxSceneTransition::endTo() {
+	to.end();
+}
+
+void ofxSceneTransition::clearTo() {
+	beginTo();
+	endTo();
+}
+
+//--------------------------------------------------------------
+void ofxSceneTransition::draw(float t, float x, float y) {
+	if(!isAllocated()) {
+		return;
+	}
+	t = ofClamp(t, 0, 1);
+	ofPushStyle();
+	ofSetColor(255);
+	switch(type) {
+
+		case NONE: // cut at the end
+			if(t < 1) {
+				from.draw(x, y);
+			}
+			else {
+				to.draw(x, y);
+			}
+			break;
+
+		case CROSSFADE:
+			from.draw(x, y);
+			ofEnableAlphaBlending();
+			ofSetColor(255, 255, 255, 255 * t);
+			to.draw(x, y);
+			break;
+
+		case WIPE:
+			from.draw(x, y);
+			if(t > 0) {
+				to.getTexture().drawSubsection(x, y, width * t, height, 0, 0);
+			}
+			break;
+
+		case DISSOLVE: {
+			from.draw(x, y);
+
+			// build a quad for each revealed cell
+			float cellW = (float) width / dissolveCols;
+			float cellH = (float) height / dissolveRows;
+			unsigned int n = 0;
+			for(unsigned int row = 0; row < dissolveRows; ++row) {
+				for(unsigned int col = 0; col < dissolveCols; ++col) {
+					if(getDissolveThreshold(col, row) < t) {
+						_addCell(n++, col * cellW, row * cellH, cellW, cellH);
+					}
+				}
+			}
+			dissolveMesh.getVertices().resize(n * 6);
+			dissolveMesh.getTexCoords().resize(n * 6);
+			if(n > 0) {
+				ofPushMatrix();
+				ofTranslate(x, y);
+				to.getTexture().bind();
+				dissolveMesh.draw();
+				to.getTexture().unbind();
+				ofPopMatrix();
+			}
+			break;
+		}
+	}
+	ofPopStyle();
+}
+
+//--------------------------------------------------------------
+bool ofxSceneTransition::composite(const ofPixels &from, const ofPixels &to, ofPixels &out, float t) {
+	if(from.getWidth() != to.getWidth() || from.getHeight() != to.getHeight() ||
+	   from.getNumChannels() != to.getNumChannels()) {
+		ofLogWarning("ofxSceneTransition") << "cannot composite, image sizes or channels do not match";
+		return false;
+	}
+	size_t w = from.getWidth(), h = from.getHeight(), c = from.getNumChannels();
+	if(!out.isAllocated() || out.getWidth() != w || out.getHeight() != h || out.getNumChannels() != c) {
+		out.allocate(w, h, c);
+	}
+	t = ofClamp(t, 0, 1);
+
+	const unsigned char *f = from.getData();
+	const unsigned char *s = to.getData();
+	unsigned char *o = out.getData();
+	size_t rowSize = w * c;
+	switch(type) {
+
+		case NONE: // cut at the end
+			std::copy(t < 1 ? f : s, (t < 1 ? f : s) + rowSize * h, o);
+			break;
+
+		case CROSSFADE:
+			for(size_t i = 0; i < rowSize * h; ++i) {
+				o[i] = (unsigned char)(f[i] + (s[i] - f[i]) * t + 0.5f);
+			}
+			break;
+
+		case WIPE: {
+			size_t edge = (size_t)(w * t + 0.5f) * c; // pixels left of the edge
+			for(size_t y = 0; y < h; ++y) {
+				size_t row = y * rowSize;
+				std::copy(s + row, s + row + edge, o + row);
+				std::copy(f + row + edge, f + row + rowSize, o + row + edge);
+			}
+			break;
+		}
+
+		case DISSOLVE:
+			for(size_t y = 0; y < h; ++y) {
+				unsigned int cellRow = (unsigned int)((y + 0.5f) * dissolveRows / h);
+				for(size_t x = 0; x < w; ++x) {
+					unsigned int cellCol = (unsigned int)((x + 0.5f) * dissolveCols / w);
+					size_t i = (y * w + x) * c;
+					const unsigned char *src = (getDissolveThreshold(cellCol, cellRow) < t) ? s : f;
+					std::copy(src + i, src + i + c, o + i);
+				}
+			}
+			break;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------
+void ofxSceneTransition::setDissolveCells(unsigned int cols, unsigned int rows) {
+	dissolveCols = (cols > 0) ? cols : 1;
+	dissolveRows = (rows > 0) ? rows : 1;
+	dissolveMesh.getVertices().reserve(dissolveCols * dissolveRows * 6);
+	dissolveMesh.getTexCoords().reserve(dissolveCols * dissolveRows * 6);
+}
+
+// integer hash of the cell position, so the order is the same every time
+float ofxSceneTransition::getDissolveThreshold(unsigned int col, unsigned int row) {
+	unsigned int h = (col * 73856093u) ^ (row * 19349663u);
+	h ^= h >> 16;
+	h *= 0x7feb352du;
+	h ^= h >> 15;
+	h *= 0x846ca68bu;
+	h ^= h >> 16;
+	return (h >> 8) / 16777216.0f; // 24 bits -> [0, 1)
+}
+
+/* ***** PROTECTED ***** */
+
+//--------------------------------------------------------------
+void ofxSceneTransition::_addCell(unsigned int n, float x, float y, float w, float h) {
+	std::vector<ofDefaultVertexType> &verts = dissolveMesh.getVertices();
+	std::vector<ofDefaultTexCoordType> &coords = dissolveMesh.getTexCoords();
+	unsigned int v = n * 6;
+	if(verts.size() < v + 6) {
+		verts.resize(v + 6);
+		coords.resize(v + 6);
+	}
+	float xs[6] = {x, x + w, x + w, x, x + w, x};
+	float ys[6] = {y, y, y + h, y, y + h, y + h};
+	for(unsigned int i = 0; i < 6; ++i) {
+		verts[v+i] = ofDefaultVertexType(xs[i], ys[i], 0);
+		coords[v+i] = to.getTexture().getCoordFromPoint(xs[i], ys[i]);
+	}
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include "ofFbo.h"
+#include "ofPixels.h"
+#include "ofVboMesh.h"
+
+///	\class  ofxSceneTransition
+///	\brief  composites two offscreen scene buffers with a transition
+///
+/// the outgoing and incoming scenes are drawn into two fbos which are reused
+/// between transitions and only reallocated when the size changes
+///
+/// transitions:
+///   * CROSSFADE: blends from the outgoing to the incoming scene
+///   * WIPE: reveals the incoming scene from left to right
+///   * DISSOLVE: reveals the incoming scene in randomly ordered cells
+///
+/// the same compositing is available on the CPU for ofPixels with composite()
+///
+/// note: blending is linear, so scenes should draw opaque backgrounds for
+///       the fbo and pixel results to match
+class ofxSceneTransition {
+
+	public:
+
+		/// transition types
+		enum Type {
+			NONE,      //< no transition, scenes are drawn directly
+			CROSSFADE, //< blend from -> to
+			WIPE,      //< reveal to from left to right
+			DISSOLVE   //< reveal to in randomly ordered cells
+		};
+
+		ofxSceneTransition(Type type=NONE, unsigned int durationMS=1000);
+		virtual ~ofxSceneTransition() {}
+
+	/// \section Buffers
+
+		/// allocate the from & to buffers, does nothing if already allocated
+		/// at this size
+		void allocate(int w, int h);
+
+		/// are the buffers allocated?
+		bool isAllocated();
+
+		/// get the buffer size
+		int getWidth()  {return width;}
+		int getHeight() {return height;}
+
+		/// draw into the outgoing scene buffer, clears the buffer
+		void beginFrom();
+		void endFrom();
+
+		/// draw into the incoming scene buffer, clears the buffer
+		void beginTo();
+		void endTo();
+
+		/// clear the incoming scene buffer
+		void clearTo();
+
+		/// get the buffers
+		ofFbo& getFrom() {return from;}
+		ofFbo& getTo()   {return to;}
+
+	/// \section Composite
+
+		/// draw the buffers composited at a normalized transition position,
+		/// 0 is all from & 1 is all to
+		void draw(float t, float x=0, float y=0);
+
+		/// composite two images at a normalized transition position into out,
+		/// the images must be the same size & number of channels
+		///
+		/// out is only reallocated when the size or channels change
+		///
+		/// returns false if the images do not match
+		bool composite(const ofPixels &from, const ofPixels &to, ofPixels &out, float t);
+
+	/// \section Settings
+
+		/// get/set the transition type
+		void setType(Type type) {this->type = type;}
+		Type getType()          {return type;}
+
+		/// get/set the transition duration in ms
+		void setDuration(unsigned int durationMS) {duration = durationMS;}
+		unsigned int getDuration()                {return duration;}
+
+		/// get/set the number of dissolve cells, default: 64 x 36
+		void setDissolveCells(unsigned int cols, unsigned int rows);
+		unsigned int getDissolveCols() {return dissolveCols;}
+		unsigned int getDissolveRows() {return dissolveRows;}
+
+		/// get the normalized position at which a dissolve cell switches from
+		/// the outgoing to the incoming scene
+		float getDissolveThreshold(unsigned int col, unsigned int row);
+
+	protected:
+
+		/// add a textured cell quad to the dissolve mesh
+		void _addCell(unsigned int n, float x, float y, float w, float h);
+
+		Type type; //< transition type
+		unsigned int duration; //< transition duration in ms
+
+		ofFbo from; //< outgoing scene buffer
+		ofFbo to;   //< incoming scene buffer
+		int width, height; //< buffer size
+
+		unsigned int dissolveCols, dissolveRows; //< dissolve grid size
+		ofVboMesh dissolveMesh; //< revealed dissolve cells
+};
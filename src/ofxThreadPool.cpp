@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#include "ofxThreadPool.h"
+
+#include <algorithm>
+
+//--------------------------------------------------------------
+ofxThreadPool::ofxThreadPool(unsigned int numThreads) : nextQueue(0), queued(0), bStop(false) {
+	if(numThreads == 0) {
+		unsigned int hardware = std::thread::hardware_concurrency();
+		numThreads = (hardware > 1) ? hardware - 1 : 1;
+	}
+	for(unsigned int i = 0; i < numThreads; ++i) {
+		queues.push_back(std::unique_ptr<Queue>(new Queue));
+	}
+	for(unsigned int i = 0; i < numThreads; ++i) {
+		threads.push_back(std::thread(&ofxThreadPool::_run, this, i));
+	}
+}
+
+//--------------------------------------------------------------
+ofxThreadPool::~ofxThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		bStop = true;
+	}
+	sleepCondition.notify_all();
+	for(unsigned int i = 0; i < threads.size(); ++i) {
+		threads[i].join();
+	}
+}
+
+//--------------------------------------------------------------
+void ofxThreadPool::parallelFor(unsigned int count, unsigned int grainSize,
+                                const std::function<void(unsigned int, unsigned int)> &func) {
+	if(count == 0) {
+		return;
+	}
+	if(grainSize == 0) {
+		grainSize = 1;
+	}
+	if(threads.empty() || count <= grainSize) {
+		func(0, count);
+		return;
+	}
+
+	// chunks are claimed from a shared counter by the calling thread & by
+	// helper tasks on the workers, so the calling thread only ever runs
+	// chunks of this range & never another queued task
+	struct Range {
+		std::atomic<unsigned int> next; //< next chunk to claim
+		std::atomic<unsigned int> remaining; //< chunks not finished yet
+	};
+	unsigned int numChunks = (count + grainSize - 1) / grainSize;
+	std::shared_ptr<Range> range(new Range);
+	range->next.store(0, std::memory_order_relaxed);
+	range->remaining.store(numChunks, std::memory_order_relaxed);
+
+	// runs chunks until none are left to claim, func is only called while
+	// chunks are remaining, so it is still valid
+	auto runChunks = [range, &func, count, grainSize, numChunks]() {
+		unsigned int chunk;
+		while((chunk = range->next.fetch_add(1, std::memory_order_relaxed)) < numChunks) {
+			unsigned int begin = chunk * grainSize;
+			func(begin, std::min(begin + grainSize, count));
+			range->remaining.fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	// one helper per worker, a helper which starts late simply finds no chunks
+	unsigned int numHelpers = std::min(numChunks - 1, (unsigned int) queues.size());
+	for(unsigned int i = 0; i < numHelpers; ++i) {
+		_push(nextQueue++ % queues.size(), runChunks);
+	}
+
+	// help out, then wait for chunks still running on the workers
+	runChunks();
+	while(range->remaining.load(std::memory_order_acquire) > 0) {
+		std::this_thread::yield();
+	}
+}
+
+//--------------------------------------------------------------
+std::future<void> ofxThreadPool::submit(const std::function<void()> &task) {
+	std::shared_ptr<std::packaged_task<void()>> packaged(new std::packaged_task<void()>(task));
+	std::future<void> future = packaged->get_future();
+	_push(nextQueue++ % queues.size(), [packaged]() {
+		(*packaged)();
+	});
+	return future;
+}
+
+//--------------------------------------------------------------
+ofxThreadPool& ofxThreadPool::shared() {
+	static ofxThreadPool pool;
+	return pool;
+}
+
+/* ***** PRIVATE ***** */
+
+//--------------------------------------------------------------
+void ofxThreadPool::_push(unsigned int index, const std::function<void()> &task) {
+	{
+		std::lock_guard<std::mutex> lock(queues[index]->mutex);
+		queues[index]->tasks.push_back(task);
+	}
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		queued++;
+	}
+	sleepCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+bool ofxThreadPool::_findTask(unsigned int index, std::function<void()> &task) {
+
+	// own queue first, newest task
+	if(index < queues.size()) {
+		Queue &queue = *queues[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if(!queue.tasks.empty()) {
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+			std::lock_guard<std::mutex> sleepLock(sleepMutex);
+			queued--;
+			return true;
+		}
+	}
+
+	// steal the oldest task from the others
+	for(unsigned int i = 1; i <= queues.size(); ++i) {
+		Queue &queue = *queues[(index + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if(!queue.tasks.empty()) {
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			std::lock_guard<std::mutex> sleepLock(sleepMutex);
+			queued--;
+			return true;
+		}
+	}
+	return false;
+}
+
+//--------------------------------------------------------------
+void ofxThreadPool::_run(unsigned int index) {
+	std::function<void()> task;
+	while(true) {
+		if(_findTask(index, task)) {
+			task();
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		sleepCondition.wait(lock, [this]() {return bStop || queued > 0;});
+		if(bStop && queued == 0) {
+			return;
+		}
+	}
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+///	\class  ofxThreadPool
+///	\brief  a small work-stealing thread pool
+///
+/// each worker thread has its own task queue and steals from the other queues
+/// when it runs out of work
+class ofxThreadPool {
+	public:
+
+		/// create a pool with a given number of worker threads,
+		/// 0 uses the number of hardware threads - 1 (for the calling thread)
+		ofxThreadPool(unsigned int numThreads=0);
+		virtual ~ofxThreadPool();
+
+	/// \section Tasks
+
+		/// run func(begin, end) over the range [0, count) in chunks of grainSize,
+		/// blocks until all chunks are done, the calling thread helps with the work
+		///
+		/// the calling thread only runs chunks of this range, never other queued
+		/// tasks, so long submit() tasks can't stall it
+		///
+		/// note: runs on the calling thread only if there are no worker threads
+		///       or the range fits in a single chunk
+		void parallelFor(unsigned int count, unsigned int grainSize,
+		                 const std::function<void(unsigned int, unsigned int)> &func);
+
+		/// queue a single task, returns a future to wait on the result
+		std::future<void> submit(const std::function<void()> &task);
+
+	/// \section Util
+
+		/// get the number of worker threads
+		unsigned int getNumThreads() {return threads.size();}
+
+		/// get a shared pool, created on first use
+		static ofxThreadPool& shared();
+
+	private:
+
+		/// a worker's task queue
+		struct Queue {
+			std::deque<std::function<void()>> tasks;
+			std::mutex mutex;
+		};
+
+		/// push a task onto a worker's queue & wake a worker
+		void _push(unsigned int index, const std::function<void()> &task);
+
+		/// pop a task from the given queue's back or steal one from the front
+		/// of another queue, returns false if no task was found
+		bool _findTask(unsigned int index, std::function<void()> &task);
+
+		/// worker thread loop
+		void _run(unsigned int index);
+
+		std::vector<std::unique_ptr<Queue>> queues; //< one task queue per worker
+		std::vector<std::thread> threads; //< worker threads
+		std::atomic<unsigned int> nextQueue; //< round robin queue index for new tasks
+
+		std::mutex sleepMutex; //< guards sleeping & queued count
+		std::condition_variable sleepCondition; //< wakes sleeping workers
+		unsigned int queued; //< total number of queued tasks
+		bool bStop; //< stop the worker threads?
+};
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "ofxMovingAverage.h"
+
+/// a moving average filled from one thread & read from another
+///
+/// the producer thread (ie. audio) pushes values into a lock-free single
+/// producer/single consumer ring buffer and the consumer thread (ie. render)
+/// drains it into an ofxMovingAverage when reading the average, neither side
+/// locks or blocks
+///
+/// values are dropped if the ring buffer is full, make sure the queue is large
+/// enough for the values added between reads
+///
+/// usage:
+///
+///     // audio thread
+///     void audioIn(ofSoundBuffer &buffer) {
+///         rms.add(buffer.getRMSAmplitude());
+///     }
+///
+///     // render thread
+///     void draw() {
+///         float level = rms.avg();
+///     }
+///
+/// note: only one thread may add & only one thread may read
+class ofxThreadedMovingAverage {
+
+	public:
+
+		/// specified window size & queue size, the queue size is rounded up to
+		/// a power of 2
+		ofxThreadedMovingAverage(unsigned int windowSize=10, unsigned int queueSize=8192) :
+			average(windowSize), writePos(0), readPos(0), dropped(0) {
+			unsigned int size = 2;
+			while(size < queueSize) {
+				size <<= 1;
+			}
+			queue.resize(size);
+			mask = size - 1;
+		}
+
+	/// \section Producer
+
+		/// add a new number, returns false if the queue is full & the value
+		/// was dropped
+		bool add(double val) {
+			return add(&val, 1) == 1;
+		}
+
+		/// add a buffer of numbers, returns how many were added,
+		/// the rest are dropped if the queue is full
+		unsigned int add(const double *vals, unsigned int n) {return _push(vals, n);}
+		unsigned int add(const float *vals, unsigned int n)  {return _push(vals, n);}
+
+	/// \section Consumer
+
+		/// get the average value, reads all queued values first
+		double avg() {
+			_drain();
+			return average.avg();
+		}
+
+		/// set (resize) the window size, call from the consumer thread
+		void setSize(unsigned int windowSize) {
+			_drain();
+			average.setSize(windowSize);
+		}
+
+		/// get the window size
+		unsigned int size() {
+			return average.size();
+		}
+
+		/// clear the window & any queued values, call from the consumer thread
+		void clear() {
+			readPos.store(writePos.load(std::memory_order_acquire), std::memory_order_release);
+			average.clear();
+		}
+
+		/// get the number of values dropped because the queue was full
+		unsigned int getNumDropped() {
+			return dropped.load(std::memory_order_relaxed);
+		}
+
+	protected:
+
+		/// push values into the ring buffer
+		template <typename T>
+		unsigned int _push(const T *vals, unsigned int n) {
+			unsigned int w = writePos.load(std::memory_order_relaxed);
+			unsigned int r = readPos.load(std::memory_order_acquire);
+			unsigned int space = queue.size() - (w - r);
+			unsigned int num = std::min(n, space);
+			for(unsigned int i = 0; i < num; ++i) {
+				queue[(w + i) & mask] = vals[i];
+			}
+			writePos.store(w + num, std::memory_order_release);
+			if(num < n) {
+				dropped.fetch_add(n - num, std::memory_order_relaxed);
+			}
+			return num;
+		}
+
+		/// read all queued values into the average
+		void _drain() {
+			unsigned int r = readPos.load(std::memory_order_relaxed);
+			unsigned int w = writePos.load(std::memory_order_acquire);
+			unsigned int num = w - r;
+			if(num == 0) {
+				return;
+			}
+
+			// at most two contiguous segments
+			unsigned int start = r & mask;
+			unsigned int first = std::min(num, (unsigned int)queue.size() - start);
+			average.add(queue.data() + start, first);
+			average.add(queue.data(), num - first);
+			readPos.store(w, std::memory_order_release);
+		}
+
+		ofxMovingAverage average; //< consumer side average
+		std::vector<double> queue; //< ring buffer of queued values
+		unsigned int mask; //< ring buffer index mask
+
+		alignas(64) std::atomic<unsigned int> writePos; //< producer position
+		alignas(64) std::atomic<unsigned int> readPos;  //< consumer position
+		std::atomic<unsigned int> dropped; //< number of dropped values
+};
@@ -11,13 +11,23 @@
 #pragma once
 
 #include "ofUtils.h"
+#include "ofxClock.h"
+
+#include <atomic>
+#include <cstdint>
 
 ///	\class	Timer
 ///	\brief	a simple millis timer/alarm
+///
+/// uses a monotonic clock with 64 bit nanosecond timestamps, so it does not
+/// wrap around & can time sub-millisecond work
+///
+/// the clock source can be replaced for all timers with setClock(), ie. an
+/// ofxManualClock to step time at a fixed rate
 class ofxTimer {
 	public:
 	
-		ofxTimer() : alarmMS(0), alarmstamp(0) {set();}
+		ofxTimer() : alarmNS(0), alarmstamp(0) {set();}
 		ofxTimer(const unsigned int alarmTime) {setAlarm(alarmTime);}
 		virtual ~ofxTimer() {}
 		
@@ -27,7 +37,7 @@ class ofxTimer {
 		}
 		/// copy operator
 		ofxTimer& operator=(const ofxTimer &from) {
-			alarmMS = from.alarmMS;
+			alarmNS = from.alarmNS;
 			alarmstamp = from.alarmstamp;
 			timestamp = from.timestamp;
 			return *this;
@@ -35,40 +45,96 @@ class ofxTimer {
 		
 		/// set the timestamp to the current time
 		inline void set() {
-			timestamp = ofGetElapsedTimeMillis();
+			timestamp = now();
 		}
 		
 		/// set the timestamp and alarm
 		/// \param	alarmTime	how many ms in the future the alarm should go off
 		inline void setAlarm(const unsigned int alarmTime) {
-			alarmMS = alarmTime;
-			timestamp = ofGetElapsedTimeMillis();
+			setAlarmNanos((uint64_t)alarmTime * 1000000);
+		}
+
+		/// set the timestamp and alarm
+		/// \param	alarmTime	how many ns in the future the alarm should go off
+		inline void setAlarmNanos(const uint64_t alarmTime) {
+			alarmNS = alarmTime;
+			timestamp = now();
 			alarmstamp = timestamp + alarmTime;
 		}
 		
 		/// set the alarm using the existing alarm time
 		inline void resetAlarm() {
-			setAlarm(alarmMS);
+			setAlarmNanos(alarmNS);
 		}
 		
 		/// has the alarm gone off?
 		inline bool alarm() {
-			return ofGetElapsedTimeMillis() >= alarmstamp;
+			return now() >= alarmstamp;
 		}
 		
 		/// returns how many ms have expired since the timestamp was last set
-		inline unsigned int getDiff() {
-			return ofGetElapsedTimeMillis() - timestamp;
+		inline uint64_t getDiff() {
+			return getDiffNanos() / 1000000;
+		}
+
+		/// returns how many us have expired since the timestamp was last set
+		inline uint64_t getDiffMicros() {
+			return getDiffNanos() / 1000;
+		}
+
+		/// returns how many ns have expired since the timestamp was last set
+		inline uint64_t getDiffNanos() {
+			uint64_t time = now();
+			return (time > timestamp) ? time - timestamp : 0;
 		}
 		
 		/// returns the difference between 0 and 1 (normalized)
 		inline float getDiffN() {
-			return (float)getDiff()/(float)alarmMS;
+			return (float)((double)getDiffNanos()/(double)alarmNS);
+		}
+
+		/// get the length of the alarm in ms
+		inline unsigned int getAlarmTime() {
+			return alarmNS / 1000000;
+		}
+
+		/// get the alarm time as a monotonic clock time in ns
+		inline uint64_t getAlarmStamp() const {
+			return alarmstamp;
+		}
+
+		/// get the current clock time in ns
+		static inline uint64_t now() {
+			ofxClock *clock = _clock().load(std::memory_order_acquire);
+			return (clock == NULL) ? ofxSteadyClock::get() : clock->now();
+		}
+
+		/// set the clock source used by all timers, this object is never deleted,
+		/// set NULL to go back to the default monotonic system clock
+		///
+		/// note: existing timestamps are not converted, reset running timers
+		///       after changing the clock, diffs from timestamps in the future
+		///       of the new clock are 0
+		static void setClock(ofxClock *clock) {
+			_clock().store(clock, std::memory_order_release);
+		}
+
+		/// get the current clock source, NULL if using the default
+		static ofxClock* getClock() {
+			return _clock().load(std::memory_order_acquire);
 		}
 		
 	protected:
 	
-		unsigned int alarmMS;    //< length of alarm
-		unsigned int timestamp;  //< current timestamp
-		unsigned int alarmstamp; //< future timestamp
+		uint64_t alarmNS;    //< length of alarm in ns
+		uint64_t timestamp;  //< current timestamp in ns
+		uint64_t alarmstamp; //< future timestamp in ns
+
+	private:
+
+		/// the current clock source, NULL for the default
+		static std::atomic<ofxClock*>& _clock() {
+			static std::atomic<ofxClock*> clock(NULL);
+			return clock;
+		}
 };
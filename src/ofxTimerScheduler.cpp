@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#include "ofxTimerScheduler.h"
+
+#include <algorithm>
+
+//--------------------------------------------------------------
+ofxTimerScheduler::ofxTimerScheduler() : nextId(1) {}
+
+//--------------------------------------------------------------
+uint64_t ofxTimerScheduler::add(unsigned int ms, const std::function<void()> &callback) {
+	return _add(ofxTimer::now() + (uint64_t)ms * 1000000, callback);
+}
+
+//--------------------------------------------------------------
+uint64_t ofxTimerScheduler::addNanos(uint64_t ns, const std::function<void()> &callback) {
+	return _add(ofxTimer::now() + ns, callback);
+}
+
+//--------------------------------------------------------------
+uint64_t ofxTimerScheduler::add(const ofxTimer &timer, const std::function<void()> &callback) {
+	return _add(timer.getAlarmStamp(), callback);
+}
+
+//--------------------------------------------------------------
+bool ofxTimerScheduler::cancel(uint64_t id) {
+	if(pending.erase(id) == 0) {
+		return false;
+	}
+
+	// cancelled alarms stay in the heap until they expire,
+	// clean up if they start to pile up
+	if(heap.size() > pending.size() * 2 + 64) {
+		_purge();
+	}
+	return true;
+}
+
+//--------------------------------------------------------------
+bool ofxTimerScheduler::isPending(uint64_t id) {
+	return pending.find(id) != pending.end();
+}
+
+//--------------------------------------------------------------
+void ofxTimerScheduler::clear() {
+	heap.clear();
+	pending.clear();
+	deferred.clear();
+}
+
+//--------------------------------------------------------------
+void ofxTimerScheduler::update() {
+	uint64_t now = ofxTimer::now();
+	uint64_t lastId = nextId; // alarms added by callbacks wait for the next update
+	while(!heap.empty() && heap.front().time <= now) {
+		std::pop_heap(heap.begin(), heap.end(), Later());
+		Alarm alarm = std::move(heap.back());
+		heap.pop_back();
+
+		// skip cancelled
+		if(pending.find(alarm.id) == pending.end()) {
+			continue;
+		}
+
+		// defer alarms added during this update
+		if(alarm.id >= lastId) {
+			deferred.push_back(std::move(alarm));
+			continue;
+		}
+		pending.erase(alarm.id);
+		if(alarm.callback) {
+			alarm.callback();
+		}
+	}
+
+	// put the deferred alarms back, unless cancelled in the meantime
+	for(unsigned int i = 0; i < deferred.size(); ++i) {
+		if(pending.find(deferred[i].id) != pending.end()) {
+			heap.push_back(std::move(deferred[i]));
+			std::push_heap(heap.begin(), heap.end(), Later());
+		}
+	}
+	deferred.clear();
+}
+
+//--------------------------------------------------------------
+ofxTimerScheduler& ofxTimerScheduler::shared() {
+	static ofxTimerScheduler scheduler;
+	return scheduler;
+}
+
+/* ***** PRIVATE ***** */
+
+//--------------------------------------------------------------
+uint64_t ofxTimerScheduler::_add(uint64_t time, const std::function<void()> &callback) {
+	uint64_t id = nextId++;
+	Alarm alarm = {time, id, callback};
+	heap.push_back(alarm);
+	std::push_heap(heap.begin(), heap.end(), Later());
+	pending.insert(id);
+	return id;
+}
+
+//--------------------------------------------------------------
+void ofxTimerScheduler::_purge() {
+	std::vector<Alarm>::iterator end = std::remove_if(heap.begin(), heap.end(),
+		[this](const Alarm &alarm) {return pending.find(alarm.id) == pending.end();});
+	heap.erase(end, heap.end());
+	std::make_heap(heap.begin(), heap.end(), Later());
+}
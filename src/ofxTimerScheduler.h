@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <vector>
+#include <unordered_set>
+#include <functional>
+
+#include "ofxTimer.h"
+
+///	\class	TimerScheduler
+///	\brief	fires callbacks for many alarms without polling each one
+///
+/// alarms are kept in a min-heap ordered by their alarm time, so update() only
+/// looks at the alarms which have gone off: O(expired log n) per call
+///
+/// alarms only fire when update() is called, so it must be called once per
+/// frame: ofxApp does this for the shared() scheduler before the scene manager
+/// & app update(), once per step when using a fixed timestep
+///
+/// usage with ofxApp:
+///
+///     ofxTimerScheduler::shared().add(2000, [this]() {sceneManager.nextScene();});
+///
+/// usage with your own scheduler:
+///
+///     ofxTimerScheduler scheduler;
+///     scheduler.add(2000, [this]() {sceneManager.nextScene();});
+///
+///     // in update(), every frame
+///     scheduler.update();
+///
+class ofxTimerScheduler {
+	public:
+
+		ofxTimerScheduler();
+		virtual ~ofxTimerScheduler() {}
+
+	/// \section Alarms
+
+		/// add an alarm which calls a function ms in the future,
+		/// returns the alarm id
+		uint64_t add(unsigned int ms, const std::function<void()> &callback);
+
+		/// add an alarm which calls a function ns in the future,
+		/// returns the alarm id
+		uint64_t addNanos(uint64_t ns, const std::function<void()> &callback);
+
+		/// add an alarm which calls a function when a timer's alarm goes off,
+		/// the timer is not referenced after this call, returns the alarm id
+		uint64_t add(const ofxTimer &timer, const std::function<void()> &callback);
+
+		/// cancel a pending alarm, returns false if the id is not pending
+		bool cancel(uint64_t id);
+
+		/// is an alarm still pending?
+		bool isPending(uint64_t id);
+
+		/// remove all pending alarms
+		void clear();
+
+	/// \section Update
+
+		/// call the functions of all alarms which have gone off, in alarm order
+		///
+		/// note: alarms may be added or cancelled from within a callback, alarms
+		///       added from a callback fire on the next update() at the
+		///       earliest, even if they are already due
+		void update();
+
+	/// \section Util
+
+		/// get the number of pending alarms
+		unsigned int size() {return pending.size();}
+
+		/// get a shared scheduler, created on first use, ofxApp updates it
+		/// every frame
+		static ofxTimerScheduler& shared();
+
+	private:
+
+		/// a scheduled alarm
+		struct Alarm {
+			uint64_t time; //< alarm clock time in ns
+			uint64_t id;   //< alarm id
+			std::function<void()> callback;
+		};
+
+		/// heap comparison, puts the earliest alarm at the front
+		struct Later {
+			bool operator()(const Alarm &a, const Alarm &b) const {
+				return a.time > b.time || (a.time == b.time && a.id > b.id);
+			}
+		};
+
+		/// add an alarm at a clock time
+		uint64_t _add(uint64_t time, const std::function<void()> &callback);
+
+		/// remove cancelled alarms from the heap
+		void _purge();
+
+		std::vector<Alarm> heap; //< alarms ordered by time
+		std::vector<Alarm> deferred; //< alarms added during update()
+		std::unordered_set<uint64_t> pending; //< ids of alarms which have not fired or been cancelled
+		uint64_t nextId; //< next alarm id, 0 is never used
+};
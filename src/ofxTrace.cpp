@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#include "ofxTrace.h"
+
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+
+#include "ofUtils.h"
+#include "ofLog.h"
+
+std::atomic<bool> ofxTrace::_enabled(false);
+std::atomic<unsigned int> ofxTrace::_bufferSize(16384);
+std::mutex ofxTrace::_ringsMutex;
+std::vector<std::shared_ptr<ofxTrace::Ring>> ofxTrace::_rings;
+
+// write a json string with quotes & backslashes escaped
+static void writeJsonString(std::ostream &out, const char *str) {
+	out << '"';
+	for(; *str != '\0'; ++str) {
+		if(*str == '"' || *str == '\\') {
+			out << '\\';
+		}
+		out << *str;
+	}
+	out << '"';
+}
+
+//--------------------------------------------------------------
+void ofxTrace::setEnabled(bool enabled) {
+	_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------
+void ofxTrace::add(const char *name, uint64_t start, uint64_t end) {
+	Ring &ring = _ring();
+	uint64_t head = ring.head.load(std::memory_order_relaxed);
+	Event &event = ring.events[head % ring.size];
+
+	// mark the slot as being written before touching it, the fence orders
+	// the mark before the field stores for a save() which sees any of them
+	ring.writing.store(head + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	event.name.store(name, std::memory_order_relaxed);
+	event.start.store(start, std::memory_order_relaxed);
+	event.end.store(end, std::memory_order_relaxed);
+	ring.head.store(head + 1, std::memory_order_release);
+}
+
+//--------------------------------------------------------------
+bool ofxTrace::save(const std::string &path) {
+	std::vector<std::shared_ptr<Ring>> rings;
+	{
+		std::lock_guard<std::mutex> lock(_ringsMutex);
+		rings = _rings;
+	}
+
+	std::ofstream file(ofToDataPath(path, true).c_str());
+	if(!file.is_open()) {
+		ofLogError("ofxTrace") << "could not open \"" << path << "\" for writing";
+		return false;
+	}
+	file << "{\"traceEvents\":[";
+	file << std::fixed << std::setprecision(3);
+
+	unsigned int num = 0;
+	struct Copy {
+		const char *name;
+		uint64_t start, end;
+	};
+	std::vector<Copy> events;
+	for(unsigned int r = 0; r < rings.size(); ++r) {
+		Ring &ring = *rings[r];
+
+		// copy the events, then drop any overwritten while copying
+		uint64_t head = ring.head.load(std::memory_order_acquire);
+		uint64_t first = std::max(ring.tail.load(std::memory_order_relaxed),
+		                          (head > ring.size) ? head - ring.size : 0);
+		events.resize(head - first);
+		for(uint64_t i = first; i < head; ++i) {
+			Event &event = ring.events[i % ring.size];
+			Copy &copy = events[i - first];
+			copy.name = event.name.load(std::memory_order_relaxed);
+			copy.start = event.start.load(std::memory_order_relaxed);
+			copy.end = event.end.load(std::memory_order_relaxed);
+		}
+		// the fence pairs with the one in add(): if any copied field came from
+		// a newer event, its writing mark is seen here & the older events it
+		// overwrote, including the one it was part way through, are dropped
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64_t written = ring.writing.load(std::memory_order_relaxed);
+		uint64_t valid = (written > ring.size) ? written - ring.size : 0;
+
+		for(uint64_t i = std::max(first, valid); i < head; ++i) {
+			const Copy &copy = events[i - first];
+			file << (num == 0 ? "\n" : ",\n") << "{\"name\":";
+			writeJsonString(file, copy.name);
+			file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring.tid
+			     << ",\"ts\":" << copy.start / 1000.0
+			     << ",\"dur\":" << (copy.end - copy.start) / 1000.0 << "}";
+			num++;
+		}
+	}
+
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	if(!file.good()) {
+		ofLogError("ofxTrace") << "could not write \"" << path << "\"";
+		return false;
+	}
+	ofLogVerbose("ofxTrace") << "saved " << num << " events to \"" << path << "\"";
+	return true;
+}
+
+//--------------------------------------------------------------
+void ofxTrace::clear() {
+	std::lock_guard<std::mutex> lock(_ringsMutex);
+	for(unsigned int i = 0; i < _rings.size(); ++i) {
+		_rings[i]->tail.store(_rings[i]->head.load(std::memory_order_acquire),
+		                      std::memory_order_relaxed);
+	}
+}
+
+//--------------------------------------------------------------
+void ofxTrace::setBufferSize(unsigned int size) {
+	_bufferSize.store((size > 0) ? size : 1);
+}
+
+unsigned int ofxTrace::getBufferSize() {
+	return _bufferSize.load();
+}
+
+/* ***** PRIVATE ***** */
+
+//--------------------------------------------------------------
+ofxTrace::Ring::Ring(unsigned int size, unsigned int tid) :
+	events(new Event[size]), size(size), tid(tid), head(0), writing(0), tail(0) {}
+
+//--------------------------------------------------------------
+ofxTrace::Ring& ofxTrace::_ring() {
+	static thread_local std::shared_ptr<Ring> ring;
+	if(!ring) {
+		std::lock_guard<std::mutex> lock(_ringsMutex);
+		ring = std::make_shared<Ring>(_bufferSize.load(), _rings.size());
+		_rings.push_back(ring);
+	}
+	return *ring;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Dan Wilcox <danomatika@gmail.com>
+ *
+ * BSD Simplified License.
+ * For information on usage and redistribution, and for a DISCLAIMER OF ALL
+ * WARRANTIES, see the file, "LICENSE.txt," in this distribution.
+ *
+ * See https://github.com/danomatika/ofxAppUtils for documentation
+ *
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+#include "ofxClock.h"
+
+/// trace a scope, the name must be a string literal (or otherwise outlive
+/// the trace)
+///
+///     void update() {
+///         OFX_TRACE_SCOPE("update");
+///         ...
+///     }
+///
+/// define OFX_TRACE_DISABLE to compile all trace markers out
+#ifdef OFX_TRACE_DISABLE
+	#define OFX_TRACE_SCOPE(name)
+#else
+	#define OFX_TRACE_CONCAT_(a, b) a ## b
+	#define OFX_TRACE_CONCAT(a, b) OFX_TRACE_CONCAT_(a, b)
+	#define OFX_TRACE_SCOPE(name) ofxTraceScope OFX_TRACE_CONCAT(_ofxTraceScope, __LINE__)(name)
+#endif
+
+///	\class  ofxTrace
+///	\brief  records scoped timing events & saves them as a Chrome trace
+///
+/// each thread writes its events into its own lock-free ring buffer, so
+/// tracing never blocks, the oldest events are overwritten when a ring is full
+///
+/// save() writes the buffered events as Chrome trace event JSON which can be
+/// opened in chrome://tracing or https://ui.perfetto.dev
+///
+/// tracing is off by default, markers only check a flag when disabled
+///
+/// usage:
+///
+///     ofxTrace::setEnabled(true);
+///     ...
+///     // on a key press, etc
+///     ofxTrace::save("trace.json");
+///
+class ofxTrace {
+
+	public:
+
+	/// \section Control
+
+		/// enable/disable recording trace events
+		static void setEnabled(bool enabled);
+
+		/// is recording enabled?
+		static inline bool isEnabled() {
+			return _enabled.load(std::memory_order_relaxed);
+		}
+
+		/// add a complete event with start & end times in ns from the steady
+		/// clock (see ofxSteadyClock::get()), usually called by ofxTraceScope
+		static void add(const char *name, uint64_t start, uint64_t end);
+
+		/// save the buffered events as Chrome trace JSON,
+		/// path is relative to the data folder, returns false on error
+		static bool save(const std::string &path);
+
+		/// clear all buffered events
+		static void clear();
+
+		/// get/set the number of events buffered per thread, default: 16384
+		///
+		/// note: only affects threads which have not traced yet
+		static void setBufferSize(unsigned int size);
+		static unsigned int getBufferSize();
+
+	private:
+
+		/// a trace event, fields are atomic as a ring may be read while written
+		struct Event {
+			std::atomic<const char*> name;
+			std::atomic<uint64_t> start; //< ns
+			std::atomic<uint64_t> end;   //< ns
+		};
+
+		/// a single thread's event ring buffer
+		struct Ring {
+			Ring(unsigned int size, unsigned int tid);
+			std::unique_ptr<Event[]> events; //< ring buffer
+			unsigned int size; //< ring buffer size
+			unsigned int tid;  //< trace thread id
+			std::atomic<uint64_t> head; //< total events written
+			std::atomic<uint64_t> writing; //< total events started, head + 1 while writing
+			std::atomic<uint64_t> tail; //< first event which has not been cleared
+		};
+
+		/// get the calling thread's ring, created on first use
+		static Ring& _ring();
+
+		static std::atomic<bool> _enabled; //< is recording enabled?
+		static std::atomic<unsigned int> _bufferSize; //< events per new ring
+		static std::mutex _ringsMutex; //< guards the ring list
+		static std::vector<std::shared_ptr<Ring>> _rings; //< rings of all threads
+};
+
+///	\class  ofxTraceScope
+///	\brief  adds a trace event for its lifetime, use OFX_TRACE_SCOPE
+///
+/// times are taken from the steady system clock, not the ofxTimer clock, so
+/// traces show wall time even when a manual clock is set
+class ofxTraceScope {
+
+	public:
+
+		ofxTraceScope(const char *name) : name(NULL), start(0) {
+			if(ofxTrace::isEnabled()) {
+				this->name = name;
+				start = ofxSteadyClock::get();
+			}
+		}
+
+		~ofxTraceScope() {
+			if(name != NULL) {
+				ofxTrace::add(name, start, ofxSteadyClock::get());
+			}
+		}
+
+	private:
+
+		const char *name; //< NULL when not tracing
+		uint64_t start; //< ns
+};
@@ -13,6 +13,7 @@
 #include "ofAppRunner.h"
 #include "ofGraphics.h"
 #include "ofFileUtils.h"
+#include "ofxTrace.h"
 
 //--------------------------------------------------------------
 ofxTransformer::ofxTransformer() {
@@ -154,6 +155,7 @@ void ofxTransformer::popWarp() {
 
 //--------------------------------------------------------------
 void ofxTransformer::push(bool forceWarp) {
+	OFX_TRACE_SCOPE("ofxTransformer::push");
 	if(_bTransformsPushed) {
 		return; // don't push twice
 	}
@@ -178,6 +180,7 @@ void ofxTransformer::push(bool forceWarp) {
 
 //--------------------------------------------------------------
 void ofxTransformer::pop() {
+	OFX_TRACE_SCOPE("ofxTransformer::pop");
 	if(!_bTransformsPushed) {
 		return; // avoid extra pops
 	}